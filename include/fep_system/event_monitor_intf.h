@@ -19,12 +19,31 @@ You may add additional accurate notices of copyright ownership.
 
 
 #pragma once
+#include <chrono>
+#include <set>
 #include <string>
 #include "base/logging/logging_types.h"
+#include "log_record.h"
 #include "logging_types_legacy.h"
+#include "rpc_services/participant_statemachine/participant_statemachine_rpc_intf.h"
 
 namespace fep3
 {
+/**
+ * @brief Selects the log records passed to an event monitor, see @ref fep3::System::registerMonitoring.
+ * A record is passed if it matches all criteria.
+ */
+struct EventMonitorFilter
+{
+    /// records with a lower severity (i.e. a higher value) than this are not passed
+    LoggerSeverity _severity = LoggerSeverity::debug;
+    /// names of the participants whose records are passed, all if empty.
+    /// The records of the system itself have an empty participant name.
+    std::set<std::string> _participant_names;
+    /// only records whose logger name starts with this prefix are passed
+    std::string _logger_name_prefix;
+};
+
 /// Virtual class to implement FEP System Event Monitor, used with
 /// @ref fep3::System::registerMonitoring
 class IEventMonitor
@@ -34,7 +53,25 @@ public:
     virtual ~IEventMonitor() = default;
 
     /**
-     * @brief Callback on log
+     * @brief Callback on log, the record is only valid within the call.
+     * The default implementation passes the record to the @ref onLog callback.
+     *
+     * You will only retrieve log messages above the given fep::System::setSystemSeverityLevel
+     *
+     * @param[in] record the log record
+     */
+    virtual void onLogRecord(const LogRecord& record)
+    {
+        onLog(record.getTimeAsMilliseconds(),
+            record._severity,
+            record.getParticipantName(),
+            record.getLoggerName(),
+            record._message);
+    }
+
+    /**
+     * @brief Callback on log, called by the default implementation of @ref onLogRecord.
+     * Override either this or @ref onLogRecord.
      *
      * You will only retrieve log messages above the given fep::System::setSystemSeverityLevel
      *
@@ -44,11 +81,13 @@ public:
      * @param[in] logger_name (usually the system, participant, component or element name and category)
      * @param[in] message detailed message
      */
-    virtual void onLog(std::chrono::milliseconds log_time,
-        LoggerSeverity severity_level,
-        const std::string& participant_name,
-        const std::string& logger_name, //depends on the Category ...
-        const std::string& message) = 0;
+    virtual void onLog(std::chrono::milliseconds /*log_time*/,
+        LoggerSeverity /*severity_level*/,
+        const std::string& /*participant_name*/,
+        const std::string& /*logger_name*/, //depends on the Category ...
+        const std::string& /*message*/)
+    {
+    }
 };
 
 
@@ -29,6 +29,8 @@ You may add additional accurate notices of copyright ownership.
 #include "healthiness_types.h"
 #include "logging_types_legacy.h"
 #include "event_monitor_intf.h"
+#include "health_monitor_intf.h"
+#include "log_archive.h"
 
 ///The fep::System default timeout for every fep3::System call that need to connect to a far participant
 #define FEP_SYSTEM_DEFAULT_TIMEOUT std::chrono::milliseconds(500)
@@ -53,6 +55,126 @@ namespace fep3
      */
     using ParticipantStates = std::map<std::string, fep3::rpc::arya::IRPCParticipantStateMachine::State>;
 
+    /**
+     * @brief A map of property path and property value.
+     *
+     */
+    using PropertyValues = std::map<std::string, std::string>;
+
+    /**
+     * @brief A map of participant name and the property values of the participant.
+     *
+     */
+    using ParticipantPropertyValues = std::map<std::string, PropertyValues>;
+
+    /**
+     * @brief A map of participant name and the property paths of the participant.
+     *
+     */
+    using ParticipantPropertyPaths = std::map<std::string, std::vector<std::string>>;
+
+    /**
+     * @brief Result of reading or writing several properties of one participant.
+     *
+     */
+    struct PropertyAccessResult
+    {
+        /**
+         * @brief the values by property path, only filled when reading properties
+         *
+         */
+        PropertyValues _values;
+
+        /**
+         * @brief the error messages by property path of the properties which could not be accessed.
+         * The empty path is used for errors concerning the whole participant (i.e. not found or not reachable).
+         *
+         */
+        std::map<std::string, std::string> _errors;
+    };
+
+    /**
+     * @brief A map of participant name and the result of the property access.
+     *
+     */
+    using PropertyAccessResults = std::map<std::string, PropertyAccessResult>;
+
+    /**
+     * @brief Result of applying a desired configuration to one participant.
+     *
+     */
+    struct ConfigurationApplyResult
+    {
+        /**
+         * @brief number of properties written, since their value differed from the desired one
+         *
+         */
+        uint32_t _written = 0;
+
+        /**
+         * @brief number of properties not written, since they already had the desired value
+         *
+         */
+        uint32_t _skipped = 0;
+
+        /**
+         * @brief the error messages by property path of the properties which could not be applied.
+         * The empty path is used for errors concerning the whole participant (i.e. not found or not reachable).
+         *
+         */
+        std::map<std::string, std::string> _errors;
+    };
+
+    /**
+     * @brief A map of participant name and the result of applying the desired configuration.
+     *
+     */
+    using ConfigurationApplyResults = std::map<std::string, ConfigurationApplyResult>;
+
+    /**
+     * @brief Offset of the main clock of one participant to the main clock of the reference participant.
+     *
+     */
+    struct ClockOffsetResult
+    {
+        /**
+         * @brief time of the participant's main clock minus the time of the reference's main clock
+         *
+         */
+        std::chrono::nanoseconds _offset{ 0 };
+
+        /**
+         * @brief maximum error of the offset, the sum of the half round trip times of the
+         * participant's and the reference's best sample. 0 for the reference itself.
+         *
+         */
+        std::chrono::nanoseconds _uncertainty{ 0 };
+
+        /**
+         * @brief the shortest round trip time of the requests to the participant
+         *
+         */
+        std::chrono::nanoseconds _round_trip_time{ 0 };
+
+        /**
+         * @brief number of valid samples taken from the participant
+         *
+         */
+        uint32_t _samples = 0;
+
+        /**
+         * @brief error message if the offset could not be measured, the other members are 0 then
+         *
+         */
+        std::string _error;
+    };
+
+    /**
+     * @brief A map of participant name and the offset of its main clock.
+     *
+     */
+    using ClockOffsetResults = std::map<std::string, ClockOffsetResult>;
+
     /**
      * @brief System state
      * The aggregated state is always the lowest state of the participants.
@@ -352,6 +474,117 @@ namespace fep3
         std::string getParticipantProperty(const std::string& participant_name,
                                            const std::string& property_path) const;
 
+        /**
+        * @brief set several properties of several participants.
+        * The participants are configured concurrently, the properties of one participant one after another.
+        * A failing property does not stop the others from being set.
+        *
+        * @param[in] property_values  the property values by participant name
+        * @return PropertyAccessResults the errors by participant name, participants without errors have no entry in @c _errors
+        */
+        PropertyAccessResults setParticipantProperties(const ParticipantPropertyValues& property_values) const;
+
+        /**
+        * @brief set the same properties of all participants of the system.
+        * @see setParticipantProperties
+        *
+        * @param[in] property_values  the property values to set
+        * @return PropertyAccessResults the errors by participant name
+        */
+        PropertyAccessResults setPropertiesOfAllParticipants(const PropertyValues& property_values) const;
+
+        /**
+        * @brief get several properties of several participants.
+        * The participants are read concurrently, the properties of one participant one after another.
+        * A failing property does not stop the others from being read.
+        *
+        * @param[in] property_paths   the property paths by participant name
+        * @return PropertyAccessResults the values and errors by participant name
+        */
+        PropertyAccessResults getParticipantProperties(const ParticipantPropertyPaths& property_paths) const;
+
+        /**
+        * @brief apply a desired configuration with as few writes as possible.
+        * The current values of every properties node are read in bulk and only properties
+        * with a different value are written. The participants are configured concurrently.
+        * Values are compared as strings, so differently formatted but equal values are written again.
+        *
+        * @param[in] desired_values   the desired property values by participant name
+        * @return ConfigurationApplyResults the number of written and skipped properties and the errors by participant name
+        */
+        ConfigurationApplyResults applyDesiredConfiguration(const ParticipantPropertyValues& desired_values) const;
+
+        /**
+        * @brief save the configuration of all participants into a snapshot file.
+        * The snapshot contains the whole property tree (including the timing configuration)
+        * and the init and start priority of every participant.
+        * The participants are read concurrently in chunks and every chunk is written to the file
+        * before the next one is read, so the whole configuration is never held in memory at once.
+        * Participants which could not be read are not part of the snapshot.
+        *
+        * @param[in] file_path  the file to write the snapshot to, an existing file is overwritten
+        * @return PropertyAccessResults the errors by participant name
+        * @throw runtime_error if the file can not be written
+        */
+        PropertyAccessResults saveConfiguration(const std::string& file_path) const;
+
+        /**
+        * @brief restore the configuration saved by @ref saveConfiguration.
+        * The participants are read from the file in chunks and configured concurrently.
+        * Only properties with a different value are written (see @ref applyDesiredConfiguration).
+        * The init and start priorities of the participants are restored as well.
+        * Participants of the snapshot which are not part of the system are reported as error.
+        *
+        * @param[in] file_path  the snapshot file to restore
+        * @return ConfigurationApplyResults the number of written and skipped properties and the errors by participant name
+        * @throw runtime_error if the file can not be read, is malformed or has an unsupported version
+        */
+        ConfigurationApplyResults restoreConfiguration(const std::string& file_path);
+
+        /**
+        * @brief read the properties of all participants into the local property mirror.
+        * The property trees are read concurrently, one bulk read per participant.
+        * The mirror is kept current by the property writes of this system, changes made by
+        * others are only visible after the next refresh.
+        * Participants which could not be read are removed from the mirror.
+        *
+        * @return PropertyAccessResults the errors by participant name
+        */
+        PropertyAccessResults refreshPropertyMirror() const;
+
+        /**
+        * @brief get mirrored property values of all participants without any remote call.
+        * A segment consisting of an asterisk matches any single segment of the property path,
+        * i.e. the cycle times of all jobs are matched by "job_registry/jobs/" + "*" + "/cycle_sim_time".
+        * @see refreshPropertyMirror
+        *
+        * @param[in] path_pattern  the pattern of the property paths
+        * @return ParticipantPropertyValues the matching values by participant name,
+        *         empty if the mirror was not refreshed or the pattern is invalid
+        */
+        ParticipantPropertyValues queryMirroredProperties(const std::string& path_pattern) const;
+
+        /**
+        * @brief find all participants whose mirrored property has a certain value, without any remote call.
+        * @see refreshPropertyMirror
+        *
+        * @param[in] property_path   the path of the property
+        * @param[in] property_value  the value to look for
+        * @return std::vector<std::string> the sorted names of the participants
+        * @throw runtime_error if the property path is invalid
+        */
+        std::vector<std::string> findParticipantsByMirroredProperty(const std::string& property_path,
+            const std::string& property_value) const;
+
+        /**
+        * @brief get the same properties of all participants of the system.
+        * @see getParticipantProperties
+        *
+        * @param[in] property_paths   the property paths to read
+        * @return PropertyAccessResults the values and errors by participant name
+        */
+        PropertyAccessResults getPropertiesOfAllParticipants(const std::vector<std::string>& property_paths) const;
+
         /**
         * @brief get the state of a participant
         *
@@ -539,6 +772,23 @@ namespace fep3
          */
         std::vector<std::string> getCurrentTimingMasters() const;
 
+        /**
+         * @brief measures the offset of the main clock of every participant to the main clock of a reference participant.
+         * The time of the main clock is requested @p rounds times from each participant, all participants concurrently.
+         * Each sample is compensated for its round trip time by assuming the time was taken in the middle
+         * of the round trip (like NTP does), the sample with the shortest round trip is used.
+         * The offsets are related to each other by a local monotonic clock, so measuring the participants
+         * at different times does not bias the result as long as their main clocks are continuous.
+         *
+         * @param[in] rounds                number of samples per participant, at least 1
+         * @param[in] reference_participant the participant to relate the offsets to,
+         *                                  if empty the timing master of the system is used
+         * @return ClockOffsetResults the offsets by participant name, unreachable participants contain an error
+         * @throw runtime_error if the reference participant is not found, there is no unique timing master
+         *                      or the clock of the reference participant cannot be measured
+         */
+        ClockOffsetResults measureClockOffsets(uint32_t rounds = 8, const std::string& reference_participant = {}) const;
+
         /**
          * retrieves the timing related properties on each participant.
          * @return participant name-property list map of timing related properties.
@@ -579,7 +829,8 @@ namespace fep3
         std::string getSystemUrl() const;
 
         /**
-        * Register monitoring listener for state and name changed notifications of the whole system
+        * Register monitoring listener for state and name changed notifications of the whole system.
+        * Any number of listeners can be registered, registering a listener again replaces its filter.
         *
         * On Failure an Incident will be send with a detailed description
         * @param[in] event_listener The listener
@@ -587,19 +838,70 @@ namespace fep3
         void registerMonitoring(IEventMonitor& event_listener);
 
         /**
-         * Unregister monitoring listener for state and name changed and logging notifications
+        * Register monitoring listener which only receives the log records passing the @p filter.
+        * The filter is evaluated before the listener is called, so a listener does not pay for the records it ignores.
+        *
+        * @param[in] event_listener The listener
+        * @param[in] filter the severity, participants and logger name prefix of the records to receive
+        */
+        void registerMonitoring(IEventMonitor& event_listener, const EventMonitorFilter& filter);
+
+        /**
+         * Unregister monitoring listener for state and name changed and logging notifications.
+         * The other listeners stay registered. The listener is not called anymore when this returns.
          *
          * @param[in] event_listener The listener
          */
         void unregisterMonitoring(IEventMonitor& event_listener);
 
         /**
-         * @brief Set the System Severity Level for all participants
+         * @brief Set the System Severity Level for all participants.
+         * Log records with a lower severity are dropped by the system before they are formatted or
+         * passed to any event monitor.
          *
          * @param[in] severity_level minimum severity level
          */
         void setSeverityLevel(LoggerSeverity severity_level);
 
+        /**
+         * @brief Set the System Severity Level and optionally apply it to the participants as well.
+         * If @p apply_to_participants is true, the severity of the root logger filter of every participant
+         * is set concurrently (see fep3::rpc::IRPCLoggingService::setLoggerFilter), keeping its logging sinks.
+         * So records below the severity are not even sent to the system. This affects all sinks of the
+         * participants, loggers with a more specific filter keep it. Participants added later are not configured.
+         * Participants which cannot be configured are logged with a warning.
+         *
+         * @param[in] severity_level minimum severity level
+         * @param[in] apply_to_participants whether to set the logger filter of the participants
+         */
+        void setSeverityLevel(LoggerSeverity severity_level, bool apply_to_participants);
+
+        /**
+         * @brief Returns the System Severity Level, see @ref setSeverityLevel.
+         */
+        LoggerSeverity getSeverityLevel() const;
+
+        /**
+         * @brief Configures the asynchronous delivery of log records to the registered event monitor.
+         * If enabled, the log records of the participants and of the system are queued and delivered
+         * by a dedicated thread, so a slow event monitor does not delay the logging of the participants.
+         * Switching the mode delivers the records queued so far. Must not be called from within
+         * IEventMonitor::onLog.
+         *
+         * @param[in] config whether to deliver asynchronously, the queue capacity and the overflow policy
+         */
+        void setAsyncLogging(const AsyncLoggingConfig& config);
+
+        /**
+         * @brief Returns the configuration of the asynchronous logging, see @ref setAsyncLogging.
+         */
+        AsyncLoggingConfig getAsyncLogging() const;
+
+        /**
+         * @brief Returns the counters of delivered, dropped and blocked log records of the asynchronous logging.
+         */
+        LoggingMetrics getLoggingMetrics() const;
+
         /**
          * @brief Set the execution policy for initialization and start state transition.
          *
@@ -625,9 +927,57 @@ namespace fep3
          */
         std::map<std::string, ParticipantHealth> getParticipantsHealth();
 
+        /**
+         * @brief Returns the health of the participants whose jobs health or running state changed
+         * since a former call. The jobs health is taken from immutable snapshots published by the
+         * health listeners, so reading it never blocks the listeners.
+         * A change of the running state is detected as soon as the liveliness timeout expires.
+         *
+         * @param[in] version the version returned by the former call, 0 to get the health of all participants
+         * @return ParticipantsHealthChanges the changed participants and the version to pass to the next call
+         * @throw runtime_error throws if health listener is deactivated (using  @ref fep3::System::setHealthListenerRunningStatus)
+         */
+        ParticipantsHealthChanges getParticipantsHealthSince(uint64_t version);
+
+        /**
+         * @brief Registers a health monitor, which is called on a dispatcher thread of the system
+         * whenever the jobs health of participants changes or their running state switches
+         * between online and offline. The health at registration time is not reported,
+         * use @ref fep3::System::getParticipantsHealth to get it.
+         *
+         * @param[in] health_monitor The monitor
+         */
+        void registerHealthMonitoring(IHealthMonitor& health_monitor);
+
+        /**
+         * @brief Unregisters a health monitor. No callback of the monitor is running after this returned,
+         * unless it is called from within the callback.
+         *
+         * @param[in] health_monitor The monitor
+         */
+        void unregisterHealthMonitoring(IHealthMonitor& health_monitor);
+
+        /**
+         * @brief Sets the time health changes are collected before they are delivered
+         * with one call of @ref fep3::IHealthMonitor::onHealthChanged. Default value is 0,
+         * every health change is delivered on its own.
+         *
+         * @param[in] batch_interval The time interval in ms.
+         */
+        void setHealthMonitoringBatchInterval(std::chrono::milliseconds batch_interval);
+
+        /**
+         * @brief Returns the time health changes are collected before they are delivered.
+         *
+         * @return std::chrono::milliseconds the batch interval.
+         */
+        std::chrono::milliseconds getHealthMonitoringBatchInterval() const;
+
         /**
          * @brief Sets the time interval after the last notify alive discovery message the participant
          *  will be considered as alive. Default value is 20 seconds.
+         *  Participants going offline are detected within a millisecond after the interval expired
+         *  and reported to the registered health monitors, see @ref fep3::System::registerHealthMonitoring.
          *
          * @param[in] liveliness_timeout The time interval in ns.
          */
@@ -662,6 +1012,82 @@ namespace fep3
          */
         std::pair<bool, bool> getHealthListenerRunningStatus() const;
 
+        /**
+         * @brief Limits the number of health requests per second.
+         * The health of a participant is requested asynchronously after each of its notify alive messages,
+         * the participants are served in turn. The limit is shared by all systems of the process.
+         *
+         * @param[in] requests_per_second maximum number of health requests per second, 0 means unlimited (default)
+         */
+        void setHealthFetchRateLimit(uint32_t requests_per_second);
+
+        /**
+         * @brief Returns the number of health requests per second allowed, 0 means unlimited.
+         */
+        uint32_t getHealthFetchRateLimit() const;
+
+        /**
+         * @brief Returns the counters of the health requests of all systems of the process.
+         *
+         * @return HealthFetchMetrics the requested, coalesced, sent, failed, dropped and waiting health requests
+         */
+        HealthFetchMetrics getHealthFetchMetrics() const;
+
+        /**
+         * @brief Sets the number of health samples kept per participant, also for participants added later.
+         * A sample is taken whenever the health of a participant is fetched, 0 switches the history off (default).
+         * The memory is bounded by the capacity times the number of jobs of a participant.
+         *
+         * @param[in] capacity the maximum number of samples per participant
+         */
+        void setHealthHistoryCapacity(size_t capacity);
+
+        /**
+         * @brief Returns the number of health samples kept per participant.
+         */
+        size_t getHealthHistoryCapacity() const;
+
+        /**
+         * @brief Returns the health samples of a participant within a time window.
+         *
+         * @param[in] participant_name the name of the participant
+         * @param[in] window the time before now
+         * @return std::vector<ParticipantHealthSample> the samples, the oldest first
+         * @throw runtime_error throws if the participant is not found
+         */
+        std::vector<ParticipantHealthSample> getParticipantHealthHistory(const std::string& participant_name,
+            std::chrono::nanoseconds window) const;
+
+        /**
+         * @brief Returns the error, simulation time and heartbeat rates of a participant within a time window,
+         * derived from its health history.
+         *
+         * @param[in] participant_name the name of the participant
+         * @param[in] window the time before now
+         * @return ParticipantHealthRates the rates
+         * @throw runtime_error throws if the participant is not found
+         */
+        ParticipantHealthRates getParticipantHealthRates(const std::string& participant_name,
+            std::chrono::nanoseconds window) const;
+
+        /**
+         * @brief Returns the real time factor of each participant and its lag behind the participant
+         * with the latest simulation time, together with the minimum, maximum and mean of the system.
+         * The progress is derived from the simulation times of the jobs reported with the health,
+         * no additional request is sent to the participants. Participants without jobs are not contained.
+         *
+         * @return SimulationProgress the progress of the participants
+         */
+        SimulationProgress getSimulationProgress() const;
+
+        /**
+         * @brief Fetches the RPC component catalog of all participants in parallel.
+         * Calling this right after discovery avoids the sequential catalog requests
+         * on the first RPC component lookup of each participant.
+         * Participants which are not reachable are logged with a warning and skipped.
+         */
+        void preloadRPCComponentCatalogs() const;
+
         /**
          * @brief Set the heartbeat interval of one participant
          *
@@ -0,0 +1,48 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#pragma once
+#include <map>
+#include <string>
+#include "healthiness_types.h"
+
+namespace fep3
+{
+/// Virtual class to implement FEP System Health Monitor, used with
+/// @ref fep3::System::registerHealthMonitoring
+class IHealthMonitor
+{
+public:
+    /// DTOR
+    virtual ~IHealthMonitor() = default;
+
+    /**
+     * @brief Callback on health changes
+     *
+     * Called on the health dispatcher thread of the system whenever the jobs health of participants
+     * changed or their running state switched between online and offline.
+     * Changes within the batch interval (see @ref fep3::System::setHealthMonitoringBatchInterval)
+     * are delivered with one call.
+     *
+     * @param[in] participants_health the changed participants with their current health
+     */
+    virtual void onHealthChanged(const std::map<std::string, ParticipantHealth>& participants_health) = 0;
+};
+}
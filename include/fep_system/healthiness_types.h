@@ -19,6 +19,8 @@ You may add additional accurate notices of copyright ownership.
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <string>
 #include <variant>
@@ -37,7 +39,7 @@ namespace fep3
         struct ClockTriggeredJobInfo
         {
             /// job cycle time
-            const std::chrono::nanoseconds cycle_time;
+            std::chrono::nanoseconds cycle_time;
         };
         /**
          * @brief Holds information about the data triggered job.
@@ -45,12 +47,12 @@ namespace fep3
         struct DataTriggeredJobInfo
         {
             /// job trigger signals
-            const std::vector<std::string> trigger_signals;
+            std::vector<std::string> trigger_signals;
         };
         ///  name of the job
-        const std::string job_name;
+        std::string job_name;
         /// job relevant information
-        const std::variant<ClockTriggeredJobInfo, DataTriggeredJobInfo>  job_info;
+        std::variant<ClockTriggeredJobInfo, DataTriggeredJobInfo>  job_info;
         /// last simulation time that JobHealthiness was updated.
         std::chrono::nanoseconds simulation_time = std::chrono::nanoseconds(0);
 
@@ -114,6 +116,8 @@ namespace fep3
         std::chrono::time_point<std::chrono::steady_clock> system_time;
         /// the participant's healthiness
         JobsHealthiness jobs_healthiness;
+        /// version of the healthiness, increases whenever the healthiness changes, 0 if none was received yet
+        uint64_t version = 0;
     };
 
     /**
@@ -127,6 +131,100 @@ namespace fep3
         JobsHealthiness jobs_healthiness;
     };
 
+    /**
+    * @brief The participants whose health changed since a certain version.
+    */
+    struct ParticipantsHealthChanges
+    {
+        /// the version of this result, pass it to the next query to get only the later changes
+        uint64_t version = 0;
+        /// the health of the participants whose jobs health or running state changed
+        std::map<std::string, ParticipantHealth> participants_health;
+    };
+
+    /**
+    * @brief Counters of the health requests sent to the participants.
+    * Health requests are sent asynchronously after notify alive messages. A request for a participant
+    * whose previous request is still waiting is coalesced with it, so only the latest one is sent.
+    */
+    struct HealthFetchMetrics
+    {
+        /// number of requested health updates
+        uint64_t requested = 0;
+        /// number of requests coalesced with a request already waiting
+        uint64_t coalesced = 0;
+        /// number of health requests sent
+        uint64_t fetched = 0;
+        /// number of sent health requests which failed with an exception, included in fetched
+        uint64_t failed = 0;
+        /// number of waiting requests dropped, since the participant was removed
+        uint64_t dropped = 0;
+        /// number of requests currently waiting
+        uint64_t pending = 0;
+    };
+
+    /**
+    * @brief One sample of the health history of a participant, taken whenever its health was fetched.
+    */
+    struct ParticipantHealthSample
+    {
+        /// time of the notify alive message the health was fetched for
+        std::chrono::time_point<std::chrono::steady_clock> system_time;
+        /// the latest simulation time of all jobs
+        std::chrono::nanoseconds simulation_time{ 0 };
+        /// the sum of the data in, execute and data out error counts by job name
+        std::map<std::string, uint64_t> jobs_error_count;
+    };
+
+    /**
+    * @brief Rates derived from the health history of a participant within a time window.
+    * Counters which decreased, e.g. since the participant was restarted, count from zero again.
+    * All rates are 0 if the window contains less than two samples.
+    */
+    struct ParticipantHealthRates
+    {
+        /// number of samples within the window
+        size_t sample_count = 0;
+        /// growth of the error count of all jobs per wall clock second
+        double errors_per_second = 0.0;
+        /// advance of the simulation time per wall clock second, 1.0 is real time
+        double simulation_time_per_second = 0.0;
+        /// mean time between two samples
+        std::chrono::nanoseconds mean_heartbeat_interval{ 0 };
+        /// standard deviation of the time between two samples
+        std::chrono::nanoseconds heartbeat_jitter{ 0 };
+    };
+
+    /**
+    * @brief Simulation progress of one participant, derived from the simulation times of its jobs
+    * reported with the health.
+    */
+    struct ParticipantSimulationProgress
+    {
+        /// the latest simulation time of all jobs reported
+        std::chrono::nanoseconds simulation_time{ 0 };
+        /// smoothed advance of the simulation time per wall clock second, 1.0 is real time,
+        /// 0 until the simulation time was reported twice
+        double real_time_factor = 0.0;
+        /// simulation time behind the participant with the latest simulation time
+        std::chrono::nanoseconds lag{ 0 };
+    };
+
+    /**
+    * @brief Simulation progress of all participants reporting a simulation time.
+    * The real time factor statistics only cover the participants with a real time factor.
+    */
+    struct SimulationProgress
+    {
+        std::map<std::string, ParticipantSimulationProgress> participants;
+        double min_real_time_factor = 0.0;
+        double max_real_time_factor = 0.0;
+        double mean_real_time_factor = 0.0;
+        std::chrono::nanoseconds min_lag{ 0 };
+        std::chrono::nanoseconds max_lag{ 0 };
+        std::chrono::nanoseconds mean_lag{ 0 };
+    };
+
     /**
     * @brief Converts participant running state string to enum value and throws domain error exception if unsuccessful.
     * 
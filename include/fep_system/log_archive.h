@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "fep_system_export.h"
+#include "event_monitor_intf.h"
+#include "log_archive_types.h"
+
+namespace fep3
+{
+/**
+ * @brief Event monitor appending the log records to a binary archive of memory mapped segment files.
+ *
+ * Register it with @ref fep3::System::registerMonitoring, an @ref EventMonitorFilter selects the archived records.
+ * Each segment stores the time range, the severities and the participants of its records, so
+ * @ref LogArchiveReader skips the segments and parts of segments which do not match a query.
+ * The summary of a segment is completed when the segment is closed, i.e. when it is full or the archive is destroyed.
+ * Segments of an archive which was not closed are read completely.
+ */
+class FEP3_SYSTEM_EXPORT LogArchive : public IEventMonitor
+{
+public:
+    /**
+     * @brief Construct a new LogArchive object starting a new segment
+     *
+     * @param[in] config the configuration of the archive
+     * @throw std::runtime_error if the directory or the segment file cannot be created
+     */
+    explicit LogArchive(const LogArchiveConfig& config);
+    /// DTOR closing the current segment
+    ~LogArchive();
+
+    LogArchive(const LogArchive&) = delete;
+    LogArchive& operator=(const LogArchive&) = delete;
+
+    /**
+     * @brief Appends the record to the archive.
+     * A message exceeding the segment size is truncated. Failures are counted, see @ref getDroppedCount.
+     *
+     * @param[in] record the log record
+     */
+    void onLogRecord(const LogRecord& record) override;
+
+    /**
+     * @brief Writes the appended records of the current segment to the disk.
+     */
+    void flush();
+
+    /**
+     * @brief Get the number of records appended to the archive.
+     *
+     * @return the number of appended records
+     */
+    uint64_t getWrittenCount() const;
+
+    /**
+     * @brief Get the number of records which could not be appended to the archive.
+     *
+     * @return the number of dropped records
+     */
+    uint64_t getDroppedCount() const;
+
+    /// @cond no_doc
+    private:
+        struct Implementation;
+        std::unique_ptr<Implementation> _impl;
+    /// @endcond no_doc
+};
+
+/**
+ * @brief Reads the records of a log archive written by @ref LogArchive, also while it is written.
+ */
+class FEP3_SYSTEM_EXPORT LogArchiveReader
+{
+public:
+    /**
+     * @brief Construct a new LogArchiveReader object
+     *
+     * @param[in] directory the directory of the segment files
+     */
+    explicit LogArchiveReader(const std::string& directory);
+    /// DTOR
+    ~LogArchiveReader();
+
+    /**
+     * @brief Passes the selected records in the order they were appended to the archive.
+     *
+     * @param[in] query selects the records
+     * @param[in] callback called for every selected record, returns false to stop the query
+     * @return the number of records passed to the callback
+     * @throw std::runtime_error if a segment file cannot be read
+     */
+    uint64_t query(const LogArchiveQuery& query, const std::function<bool(const LogArchiveEntry&)>& callback) const;
+
+    /**
+     * @brief Gets the selected records in the order they were appended to the archive.
+     *
+     * @param[in] query selects the records
+     * @return the selected records
+     * @throw std::runtime_error if a segment file cannot be read
+     */
+    std::vector<LogArchiveEntry> query(const LogArchiveQuery& query) const;
+
+    /// @cond no_doc
+    private:
+        std::string _directory;
+    /// @endcond no_doc
+};
+}
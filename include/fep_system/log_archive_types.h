@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <string>
+#include "base/logging/logging_types.h"
+
+namespace fep3
+{
+/**
+ * @brief Configuration of a @ref LogArchive.
+ */
+struct LogArchiveConfig
+{
+    /// directory of the segment files, created if it does not exist
+    std::string _directory;
+    /// size of one memory mapped segment file in bytes, a full segment is closed and a new one is started
+    uint64_t _segment_size = 64 * 1024 * 1024;
+    /// number of segments kept, the oldest segment is removed when a new one is started. 0 keeps all segments.
+    uint32_t _max_segments = 0;
+};
+
+/**
+ * @brief Selects the records read from a log archive, see @ref LogArchiveReader::query.
+ * A record is selected if it matches all criteria.
+ */
+struct LogArchiveQuery
+{
+    /// records logged before this time (since the epoch of the system clock) are not selected
+    std::chrono::nanoseconds _begin = std::chrono::nanoseconds::min();
+    /// records logged at or after this time (since the epoch of the system clock) are not selected
+    std::chrono::nanoseconds _end = std::chrono::nanoseconds::max();
+    /// records with a lower severity (i.e. a higher value) than this are not selected
+    LoggerSeverity _severity = LoggerSeverity::debug;
+    /// names of the participants whose records are selected, all if empty.
+    /// The records of the system itself have an empty participant name.
+    std::set<std::string> _participant_names;
+};
+
+/**
+ * @brief A log record read from a log archive.
+ */
+struct LogArchiveEntry
+{
+    /// time of the log since the epoch of the system clock
+    std::chrono::nanoseconds _timestamp{ 0 };
+    /// severity level of the log
+    LoggerSeverity _severity = LoggerSeverity::off;
+    /// participant name, empty on system category
+    std::string _participant_name;
+    /// logger name
+    std::string _logger_name;
+    /// detailed message
+    std::string _message;
+};
+}
@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#pragma once
+#include <chrono>
+#include <string>
+#include <utility>
+#include "base/logging/logging_types.h"
+
+namespace fep3
+{
+/**
+ * @brief A log record as passed to the event monitors, see @ref IEventMonitor::onLogRecord.
+ *
+ * The participant and logger names are interned by the system logger, i.e. all records with the
+ * same name refer to the same string which is valid for the lifetime of the process.
+ * The record is move only, so the message is moved along the logging path instead of being copied.
+ */
+struct LogRecord
+{
+    /// CTOR
+    LogRecord() = default;
+    /**
+     * @brief CTOR
+     *
+     * @param[in] timestamp time of the log since the epoch of the system clock
+     * @param[in] severity severity level of the log
+     * @param[in] participant_name participant name (null or empty on system category), must outlive the record
+     * @param[in] logger_name logger name, must outlive the record
+     * @param[in] message detailed message
+     */
+    LogRecord(std::chrono::nanoseconds timestamp,
+        LoggerSeverity severity,
+        const std::string* participant_name,
+        const std::string* logger_name,
+        std::string message)
+        : _timestamp(timestamp)
+        , _severity(severity)
+        , _participant_name(participant_name)
+        , _logger_name(logger_name)
+        , _message(std::move(message))
+    {
+    }
+    /// move CTOR
+    LogRecord(LogRecord&&) = default;
+    /// move assignment
+    LogRecord& operator=(LogRecord&&) = default;
+    LogRecord(const LogRecord&) = delete;
+    LogRecord& operator=(const LogRecord&) = delete;
+
+    /// @return the participant name, empty on system category
+    const std::string& getParticipantName() const
+    {
+        return _participant_name ? *_participant_name : getEmptyName();
+    }
+    /// @return the logger name
+    const std::string& getLoggerName() const
+    {
+        return _logger_name ? *_logger_name : getEmptyName();
+    }
+    /// @return the time of the log truncated to milliseconds, as passed to @ref IEventMonitor::onLog
+    std::chrono::milliseconds getTimeAsMilliseconds() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(_timestamp);
+    }
+
+    /// time of the log since the epoch of the system clock
+    std::chrono::nanoseconds _timestamp{ 0 };
+    /// severity level of the log
+    LoggerSeverity _severity = LoggerSeverity::off;
+    /// interned participant name, null on system category
+    const std::string* _participant_name = nullptr;
+    /// interned logger name (usually the system, participant, component or element name)
+    const std::string* _logger_name = nullptr;
+    /// detailed message
+    std::string _message;
+
+private:
+    static const std::string& getEmptyName()
+    {
+        static const std::string empty_name;
+        return empty_name;
+    }
+};
+}
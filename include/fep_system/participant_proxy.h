@@ -37,6 +37,9 @@ You may add additional accurate notices of copyright ownership.
 
 namespace fep3
 {
+class System;
+class SimulationProgressMonitor;
+
 /**
  * @brief The ParticipantProxy will provide common system access to the participants system interfaces (RPC Services).
  * use fep3::System to connect
@@ -219,6 +222,15 @@ public:
     bool getRPCComponentProxyByIID(const std::string& component_iid,
         IRPCComponentPtr& proxy_ptr) const;
 
+    /**
+     * @brief Fetches the RPC components and their interface identifiers of the participant,
+     * if they are not cached yet. Later lookups by @ref getRPCComponentProxyByIID
+     * are answered from the cache until the participant changes its state or is rediscovered.
+     *
+     * \throw runtime_error if the participant is not reachable
+     */
+    void preloadRPCComponentCatalog() const;
+
     /**
      * This will retrieve a rpc server object interface.
      * The fep3::ParticipantProxy does support following interfaces at the moment:
@@ -288,6 +300,42 @@ public:
      */
     ParticipantHealthUpdate getParticipantHealth() const;
 
+    /**
+     * @brief returns the participant health, the jobs healthiness only if it changed since @p version.
+     *
+     * @param[in] version the version of the jobs healthiness known by the caller
+     * @return ParticipantHealthUpdate the last updated health of the participant, the jobs healthiness
+     *         is empty if ParticipantHealthUpdate::version is not greater than @p version
+     * @throw runtime_error throws if health listener is deactivated
+     * (using  @ref fep3::ParticipantProxy::setHealthListenerRunningStatus)
+     */
+    ParticipantHealthUpdate getParticipantHealthSince(uint64_t version) const;
+
+    /**
+     * @brief Sets the number of health samples kept in the health history, 0 switches it off (default).
+     * A sample is taken whenever the health is fetched after a notify alive message,
+     * the oldest sample is dropped if the history is full.
+     *
+     * @param[in] capacity the maximum number of samples
+     */
+    void setHealthHistoryCapacity(size_t capacity);
+
+    /**
+     * @brief returns the samples of the health history within a time window.
+     *
+     * @param[in] window the time before now
+     * @return std::vector<ParticipantHealthSample> the samples, the oldest first
+     */
+    std::vector<ParticipantHealthSample> getHealthHistory(std::chrono::nanoseconds window) const;
+
+    /**
+     * @brief returns the rates derived from the health history within a time window.
+     *
+     * @param[in] window the time before now
+     * @return ParticipantHealthRates the error, simulation time and heartbeat rates
+     */
+    ParticipantHealthRates getHealthRates(std::chrono::nanoseconds window) const;
+
     /**
      * Activates or deactivates the health listener. Per default the health listener is activated.
      * Deactivation will reduce the load of the system, since the polling the participant's health
@@ -308,6 +356,16 @@ public:
 
     /// @cond no_documentation
 private:
+    /// the System passes its internal simulation progress monitor, updated with every fetched health
+    friend class System;
+    ParticipantProxy(const std::string& participant_name,
+        const std::string& participant_url,
+        const std::string& system_name,
+        const std::string& system_url,
+        std::shared_ptr<ISystemLogger> logger,
+        std::chrono::milliseconds default_timeout,
+        std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor);
+
     struct Implementation;
     std::shared_ptr<Implementation> _impl;
     /// @endcond no_documentation
@@ -24,6 +24,7 @@ You may add additional accurate notices of copyright ownership.
 #include <vector>
 #include <string>
 #include <memory>
+#include <stdexcept>
 #include "configuration_rpc_intf_def.h"
 #include "../../base/properties/properties_intf.h"
 
@@ -74,6 +75,43 @@ public:
      * @retval empty_shared_ptr property does not exist
      */
     virtual std::shared_ptr<const IProperties> getProperties(const std::string& property_path) const = 0;
+    /**
+     * @brief retrieve a copy of a whole subtree of the properties, including all nested nodes.
+     * The names within the returned properties are relative to @p property_path,
+     * nested nodes are separated by '/' (i.e. "clock/main_clock").
+     * Changing the returned properties does not change the participant's properties.
+     *
+     * @param[in] property_path path to the root node of the subtree
+     *
+     * @throw If the connection has a timeout or the node does not exist it will throw a runtime error.
+     *        The default implementation throws a runtime error, since reading a subtree is optional.
+     *
+     * @return returns the in-memory copy of the subtree
+     */
+    virtual std::shared_ptr<IProperties> getPropertyTree(const std::string& property_path) const
+    {
+        throw std::runtime_error("getPropertyTree('" + property_path + "') is not supported by this implementation");
+    }
+    /**
+     * @brief retrieve the value and the type of one property.
+     * The default implementation reads them through the node returned by @ref getProperties,
+     * implementations should override it to read both with a single request.
+     *
+     * @param[in] property_path full path of the property (i.e. "clock/main_clock")
+     * @param[out] value the value of the property, empty if it does not exist
+     * @param[out] type the type of the property, empty if it does not exist
+     *
+     * @throw If the connection has a timeout it will throw a runtime error
+     */
+    virtual void getPropertyValue(const std::string& property_path, std::string& value, std::string& type) const
+    {
+        const auto separator = property_path.find_last_of('/');
+        const auto node = separator == std::string::npos ?
+            getProperties(std::string()) : getProperties(property_path.substr(0, separator));
+        const auto name = separator == std::string::npos ? property_path : property_path.substr(separator + 1);
+        type = node ? node->getPropertyType(name) : std::string();
+        value = type.empty() ? std::string() : node->getProperty(name);
+    }
 };
 }
 using arya::IRPCConfiguration;
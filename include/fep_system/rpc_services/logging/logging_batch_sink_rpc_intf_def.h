@@ -0,0 +1,52 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#pragma once
+
+#include "../base/fep_rpc_iid.h"
+
+namespace fep3
+{
+namespace rpc
+{
+namespace arya
+{
+/**
+* @brief definition of the batched logging sink service the system registers
+* next to the single record logging sink client (@ref IRPCLoggingSinkClientDef).
+* Participants supporting it may deliver several log records per call.
+* @see logging_rpc_batch_sink_client.json file
+*/
+class IRPCLoggingBatchSinkClientDef
+{
+protected:
+    /**
+     * @brief Destroy the IRPCLoggingBatchSinkClientDef object
+     */
+    virtual ~IRPCLoggingBatchSinkClientDef() = default;
+
+public:
+    ///definition of the FEP rpc service iid for the batched logging sink
+    FEP_RPC_IID("logging_batch_sink_client.arya.fep3.iid", "logging_batch_sink_client");
+};
+} // namespace arya
+using arya::IRPCLoggingBatchSinkClientDef;
+} // namespace rpc
+} // namespace fep3
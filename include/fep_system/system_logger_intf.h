@@ -21,11 +21,82 @@ You may add additional accurate notices of copyright ownership.
 #pragma once
 
 #include "base/logging/logging_types.h"
+#include "log_record.h"
 #include <string>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 
 namespace fep3
 {
+    /**
+     * @brief Behaviour of the asynchronous logging if the queue of log records is full.
+     *
+     */
+    enum class LogOverflowPolicy
+    {
+        /// the oldest queued record is dropped to make room, logging never blocks
+        drop_oldest,
+        /// logging blocks until the dispatcher thread made room
+        block
+    };
+
+    /**
+     * @brief Configuration of the asynchronous delivery of log records to the event monitor.
+     *
+     */
+    struct AsyncLoggingConfig
+    {
+        /**
+         * @brief if false, log records are delivered within the logging call (default)
+         *
+         */
+        bool _enabled = false;
+
+        /**
+         * @brief maximum number of queued log records, rounded up to a power of two
+         *
+         */
+        size_t _queue_capacity = 4096;
+
+        /**
+         * @brief what happens if the queue is full
+         *
+         */
+        LogOverflowPolicy _overflow_policy = LogOverflowPolicy::drop_oldest;
+    };
+
+    /**
+     * @brief Counters of the asynchronous logging, they are kept when the configuration changes.
+     *
+     */
+    struct LoggingMetrics
+    {
+        /**
+         * @brief number of log records delivered by the dispatcher thread
+         *
+         */
+        uint64_t _delivered = 0;
+
+        /**
+         * @brief number of log records dropped since the queue was full
+         *
+         */
+        uint64_t _dropped = 0;
+
+        /**
+         * @brief number of logging calls which had to wait for the dispatcher thread
+         *
+         */
+        uint64_t _blocked = 0;
+
+        /**
+         * @brief number of log records currently queued
+         *
+         */
+        size_t _queued = 0;
+    };
+
     /**
      * @brief The system logger is an internal interfaces used within the ParticipantProxy
      * It is the connection to the IEventMonitor set within the fep3::System class.
@@ -71,6 +142,34 @@ namespace fep3
                 const std::string& logger_name, //depends on the Category ...
                 const std::string& message) const = 0;
 
+            /**
+             * @brief logs a structured log record to the system logger.
+             * The default implementation passes the values of the record to the logging call
+             * with the time truncated to milliseconds.
+             *
+             * @param[in] record the log record, moved into the logger
+             */
+            virtual void log(LogRecord&& record) const
+            {
+                log(record.getTimeAsMilliseconds(),
+                    record._severity,
+                    record.getParticipantName(),
+                    record.getLoggerName(),
+                    record._message);
+            }
+
+            /**
+             * @brief checks whether a log message of the given severity would be forwarded,
+             * so the message does not need to be formatted otherwise.
+             *
+             * @param[in] level Level
+             * @return true if the message would be forwarded
+             */
+            virtual bool isSeverityEnabled(LoggerSeverity level) const
+            {
+                return level != LoggerSeverity::off;
+            }
+
             /**
              * @brief gets a valid url for registering the system instance to the participants logging service.
              *
@@ -81,7 +180,8 @@ namespace fep3
 }
 
 /**
- * @brief Helper macro to log a message to a system logger
+ * @brief Helper macro to log a message to a system logger,
+ * the message is only formatted if its severity is enabled
  * @param[in] given_logger logger pointer
  * @param[in] given_sev Level
  * @param[in] given_part_name The name of the participant
@@ -91,11 +191,14 @@ namespace fep3
 #define FEP3_SYSTEM_LOG(given_logger, given_sev, given_part_name, given_logger_name, log_message) \
 do \
 { \
-    given_logger->log(\
-        given_sev, \
-        given_part_name, \
-        given_logger_name, \
-        std::string() + log_message); \
+    if (given_logger->isSeverityEnabled(given_sev)) \
+    { \
+        given_logger->log(\
+            given_sev, \
+            given_part_name, \
+            given_logger_name, \
+            std::string() + log_message); \
+    } \
 } while (false)
 
 /**
@@ -0,0 +1,62 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace fep3
+{
+/**
+ * @brief Estimates the offset of a remote clock to a local clock from request/response samples,
+ * like NTP does: the remote time is assumed to be taken in the middle of the round trip.
+ * Of all samples the one with the shortest round trip is used, since the asymmetry of its
+ * request and response delay and thus its error is bounded by the smallest half round trip.
+ */
+class ClockOffsetEstimator
+{
+public:
+    /**
+     * @brief Adds a sample, samples with a receive time before the send time are ignored.
+     *
+     * @param[in] local_send local time the request was sent
+     * @param[in] remote_time the time of the remote clock within the response
+     * @param[in] local_receive local time the response was received
+     */
+    void addSample(std::chrono::nanoseconds local_send,
+                   std::chrono::nanoseconds remote_time,
+                   std::chrono::nanoseconds local_receive);
+
+    /// number of samples added and not ignored
+    uint32_t getSampleCount() const;
+    bool hasEstimate() const;
+    /// remote time minus local time, 0 without any sample
+    std::chrono::nanoseconds getOffset() const;
+    /// the maximum error of @ref getOffset, half of the shortest round trip
+    std::chrono::nanoseconds getUncertainty() const;
+    std::chrono::nanoseconds getRoundTripTime() const;
+
+private:
+    uint32_t _sample_count = 0;
+    std::chrono::nanoseconds _offset{0};
+    std::chrono::nanoseconds _round_trip_time{0};
+};
+
+} // namespace fep3
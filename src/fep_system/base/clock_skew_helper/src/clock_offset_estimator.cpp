@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "clock_offset_estimator.h"
+
+namespace fep3
+{
+void ClockOffsetEstimator::addSample(std::chrono::nanoseconds local_send,
+                                     std::chrono::nanoseconds remote_time,
+                                     std::chrono::nanoseconds local_receive)
+{
+    const auto round_trip_time = local_receive - local_send;
+    if (round_trip_time.count() < 0)
+    {
+        return;
+    }
+    if (_sample_count == 0 || round_trip_time < _round_trip_time)
+    {
+        // computed as the sum of the half differences, so the midpoint does not overflow
+        _offset = (remote_time - local_send) / 2 + (remote_time - local_receive) / 2;
+        _round_trip_time = round_trip_time;
+    }
+    ++_sample_count;
+}
+
+uint32_t ClockOffsetEstimator::getSampleCount() const
+{
+    return _sample_count;
+}
+
+bool ClockOffsetEstimator::hasEstimate() const
+{
+    return _sample_count > 0;
+}
+
+std::chrono::nanoseconds ClockOffsetEstimator::getOffset() const
+{
+    return _offset;
+}
+
+std::chrono::nanoseconds ClockOffsetEstimator::getUncertainty() const
+{
+    return _round_trip_time / 2;
+}
+
+std::chrono::nanoseconds ClockOffsetEstimator::getRoundTripTime() const
+{
+    return _round_trip_time;
+}
+
+} // namespace fep3
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include <cstdint>
+#include <string_view>
+
+namespace fep3
+{
+    /**
+     * @brief Compact representation of the healthiness of all jobs of one participant.
+     * Job names, trigger signals, file and function names repeat on every update, so they are interned
+     * and only referenced. All numeric values of all jobs are kept in one flat array.
+     * The public @ref JobsHealthiness view is only built on demand.
+     */
+    class CompactJobsHealth
+    {
+    public:
+        enum class ExecuteStep : size_t
+        {
+            data_in,
+            execute,
+            data_out
+        };
+
+        void clear();
+        void reserve(size_t job_count);
+        size_t getJobCount() const;
+
+        /// adds a job, the following calls refer to the job added last
+        void addClockTriggeredJob(std::string_view job_name,
+            std::chrono::nanoseconds cycle_time,
+            std::chrono::nanoseconds simulation_time);
+        void addDataTriggeredJob(std::string_view job_name, std::chrono::nanoseconds simulation_time);
+        void addTriggerSignal(std::string_view signal_name);
+        void setExecuteError(ExecuteStep step,
+            uint64_t error_count,
+            std::chrono::nanoseconds simulation_time,
+            int error_code,
+            std::string_view error_description,
+            std::int32_t line,
+            std::string_view file,
+            std::string_view function);
+
+        /// interned, equal names of different instances refer to the same string
+        const std::string& getJobName(size_t job) const;
+        std::chrono::nanoseconds getSimulationTime(size_t job) const;
+        uint64_t getErrorCount(size_t job, ExecuteStep step) const;
+
+        /// replaces the content by the given jobs
+        void assign(const JobsHealthiness& jobs_healthiness);
+        JobsHealthiness toJobsHealthiness() const;
+
+        bool operator==(const CompactJobsHealth& other) const;
+        bool operator!=(const CompactJobsHealth& other) const;
+
+    private:
+        enum Counter : size_t
+        {
+            clock_triggered,
+            cycle_time,
+            simulation_time,
+            trigger_signals_begin,
+            trigger_signals_count,
+            first_execute_error
+        };
+        enum ErrorCounter : size_t
+        {
+            error_count,
+            error_simulation_time,
+            error_code,
+            error_line,
+            counters_per_error
+        };
+        enum StringIndex : size_t
+        {
+            job_name,
+            first_error_location
+        };
+        enum ErrorLocation : size_t
+        {
+            error_file,
+            error_function,
+            strings_per_error
+        };
+        static constexpr size_t execute_steps = 3;
+        static constexpr size_t counters_per_job = first_execute_error + execute_steps * counters_per_error;
+        static constexpr size_t strings_per_job = first_error_location + execute_steps * strings_per_error;
+
+        void addJob(std::string_view job_name, bool clock_triggered, std::chrono::nanoseconds cycle_time, std::chrono::nanoseconds simulation_time);
+        std::int64_t& counter(size_t job, size_t index);
+        std::int64_t counter(size_t job, size_t index) const;
+        JobHealthiness::ExecuteError toExecuteError(size_t job, ExecuteStep step) const;
+
+        std::vector<std::int64_t> _counters;
+        std::vector<const std::string*> _strings;
+        std::vector<const std::string*> _trigger_signals;
+        /// descriptions are not interned, they may contain arbitrary details and are mostly empty
+        std::vector<std::string> _error_descriptions;
+    };
+
+    /**
+     * @brief Source of the jobs healthiness which decodes directly into the compact representation.
+     */
+    class ICompactHealthSource
+    {
+    protected:
+        virtual ~ICompactHealthSource() = default;
+
+    public:
+        /**
+         * @brief Gets the current healthiness of all jobs.
+         *
+         * @param[out] jobs_health is cleared and filled, it stays empty if the health is not available
+         */
+        virtual void getCompactHealth(CompactJobsHealth& jobs_health) const = 0;
+    };
+}
@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace fep3
+{
+    /**
+     * @brief Client of the @ref HealthFetchQueue, i.e. the health listener of one participant.
+     */
+    class IHealthFetchClient
+    {
+    protected:
+        virtual ~IHealthFetchClient() = default;
+
+    public:
+        /**
+         * @brief Fetches and stores the health, called on a worker thread of the queue.
+         * Exceptions are caught by the queue and counted as failed fetches.
+         */
+        virtual void fetchHealth() = 0;
+    };
+
+    /**
+     * @brief Fetches the health of participants on worker threads instead of the service bus thread.
+     * A client is queued at most once, further requests while it is pending are coalesced, so the
+     * latest request wins. A client requested while its fetch is running is queued again afterwards,
+     * it is never fetched by two workers at once. The pending clients are served in request order,
+     * so every participant gets its turn before any participant is fetched again.
+     * An optional rate limit is shared by all clients.
+     */
+    class HealthFetchQueue
+    {
+    public:
+        explicit HealthFetchQueue(size_t worker_count);
+        ~HealthFetchQueue();
+        HealthFetchQueue(const HealthFetchQueue&) = delete;
+        HealthFetchQueue& operator=(const HealthFetchQueue&) = delete;
+
+        /// queues a fetch for @p client, unless one is already pending
+        void request(IHealthFetchClient* client);
+
+        /**
+         * @brief Drops a pending fetch of @p client and waits for a running one to finish.
+         * Must be called before the client is destroyed.
+         */
+        void cancel(IHealthFetchClient* client);
+
+        /// returns @c true if a fetch of @p client is pending or running
+        bool isBusy(IHealthFetchClient* client) const;
+
+        /**
+         * @brief Limits the number of fetches per second of all clients, 0 means unlimited.
+         */
+        void setRateLimit(uint32_t fetches_per_second);
+        uint32_t getRateLimit() const;
+
+        HealthFetchMetrics getMetrics() const;
+
+    private:
+        void work();
+        bool dropPending(IHealthFetchClient* client);
+
+        mutable std::mutex _sync;
+        std::condition_variable _wakeup;
+        std::condition_variable _fetch_finished;
+        std::deque<IHealthFetchClient*> _pending;
+        std::unordered_set<IHealthFetchClient*> _pending_clients;
+        std::unordered_set<IHealthFetchClient*> _running_clients;
+        /// running clients to queue again when their fetch has finished
+        std::unordered_set<IHealthFetchClient*> _requested_while_running;
+        uint32_t _rate_limit = 0;
+        std::chrono::steady_clock::time_point _next_fetch_time;
+        HealthFetchMetrics _metrics;
+        bool _stop = false;
+        std::vector<std::thread> _workers;
+    };
+
+    /**
+     * @brief Gets the queue shared by all health listeners of the process,
+     * it is created on first use and destroyed when the last user releases it.
+     */
+    std::shared_ptr<HealthFetchQueue> getHealthFetchQueue();
+
+    /// sets the rate limit of the shared queue, it is kept for queues created later
+    void setHealthFetchRateLimit(uint32_t fetches_per_second);
+    uint32_t getHealthFetchRateLimit();
+    /// @return the metrics of the shared queue, all zero if there is none
+    HealthFetchMetrics getHealthFetchMetrics();
+}
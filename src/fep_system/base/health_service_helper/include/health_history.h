@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include "compact_jobs_health.h"
+#include <mutex>
+#include <vector>
+
+namespace fep3
+{
+    /**
+     * @brief Fixed capacity ring buffer of the health samples of one participant.
+     * A sample keeps the time, the latest simulation time and the error count per job only,
+     * the job names are interned. The slots are reused, so the memory is bounded by the capacity
+     * times the number of jobs and does not grow once the buffer is full.
+     */
+    class HealthHistory
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /// a capacity of 0 records nothing
+        explicit HealthHistory(size_t capacity = 0);
+
+        /// keeps the latest samples which fit into the new capacity
+        void setCapacity(size_t capacity);
+        size_t getCapacity() const;
+
+        /// overwrites the oldest sample if full, a sample not later than the latest one is ignored
+        void record(Clock::time_point system_time, const CompactJobsHealth& jobs_health);
+
+        /// @return the samples taken at or after @p since, the oldest first
+        std::vector<ParticipantHealthSample> getSamples(Clock::time_point since) const;
+        /// @return the rates derived from the samples taken at or after @p since
+        ParticipantHealthRates getRates(Clock::time_point since) const;
+
+    private:
+        struct Sample
+        {
+            Clock::time_point _system_time;
+            std::chrono::nanoseconds _simulation_time{ 0 };
+            /// by interned job name
+            std::vector<std::pair<const std::string*, uint64_t>> _job_error_counts;
+            uint64_t _error_count = 0;
+        };
+
+        /// @return the slot of sample @p index of the @ref _size stored ones, 0 is the oldest
+        size_t getSlot(size_t index) const;
+        const Sample& at(size_t index) const;
+        /// @return the index of the oldest sample taken at or after @p since
+        size_t findFirst(Clock::time_point since) const;
+
+        mutable std::mutex _sync;
+        std::vector<Sample> _samples;
+        /// the slot of the next sample
+        size_t _next = 0;
+        size_t _size = 0;
+    };
+}
@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include "fep_system/health_monitor_intf.h"
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fep3
+{
+    /**
+     * @brief Wakes up all health notifiers of the process, called on every change of a
+     * participant's jobs health or running state.
+     */
+    void signalHealthUpdate();
+
+    /**
+     * @brief Delivers health changes to the registered @ref IHealthMonitor on a dispatcher thread.
+     * The thread wakes up on every signaled health update only, it does not poll.
+     * The thread is started with the first registered monitor.
+     */
+    class HealthNotifier
+    {
+    public:
+        /// returns the participants changed since the given version, see System::getParticipantsHealthSince
+        using HealthQuery = std::function<ParticipantsHealthChanges(uint64_t)>;
+
+        explicit HealthNotifier(HealthQuery query);
+        ~HealthNotifier();
+        HealthNotifier(const HealthNotifier&) = delete;
+        HealthNotifier& operator=(const HealthNotifier&) = delete;
+
+        void registerMonitor(IHealthMonitor* monitor);
+        /// no callback of @p monitor is running or will run after this returns, unless called from within the callback
+        void unregisterMonitor(IHealthMonitor* monitor);
+
+        /**
+         * @brief Collects the changes for @p batch_interval after a health update before delivering them,
+         * 0 delivers every health update on its own.
+         */
+        void setBatchInterval(std::chrono::milliseconds batch_interval);
+        std::chrono::milliseconds getBatchInterval() const;
+
+    private:
+        void run();
+        void deliver(const std::map<std::string, ParticipantHealth>& participants_health);
+
+        const HealthQuery _query;
+        std::recursive_mutex _monitors_sync;
+        std::vector<IHealthMonitor*> _monitors;
+        // the following are guarded by the mutex of the health update signal, so changing them wakes up the thread
+        bool _stop = false;
+        std::chrono::milliseconds _batch_interval{ 0 };
+        std::thread _thread;
+    };
+}
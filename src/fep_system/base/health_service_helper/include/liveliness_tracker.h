@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include "timer_wheel.h"
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace fep3
+{
+    /**
+     * @brief Tracks the liveliness of participants by their service update events and reports the
+     * transitions between online and offline as soon as they happen.
+     * A participant is online from its first update event on and goes offline once it did not send one
+     * for the liveliness timeout. Every online participant has one timer in a @ref TimerWheel, which is
+     * not moved on every update event, but scheduled again when it expires before the participant's timeout.
+     */
+    class LivelinessTracker : public fep3::IServiceBus::IServiceUpdateEventSink
+    {
+    public:
+        /**
+         * @brief Called on the tracker thread for offline transitions and on the caller of @ref alive
+         * for online transitions, so calls may overlap. Use @ref getRunningState to get the current state.
+         */
+        using TransitionCallback = std::function<void(const std::string& participant_name, ParticipantRunningState running_state)>;
+
+        LivelinessTracker(std::chrono::nanoseconds liveliness_timeout, TransitionCallback transition_callback);
+        ~LivelinessTracker();
+        LivelinessTracker(const LivelinessTracker&) = delete;
+        LivelinessTracker& operator=(const LivelinessTracker&) = delete;
+
+        /**
+         * @brief Tracks a participant, it is offline until its first update event unless @p last_alive_time
+         * is within the liveliness timeout. The initial running state is not reported as transition.
+         */
+        void addParticipant(const std::string& participant_name,
+            std::chrono::steady_clock::time_point last_alive_time = {});
+        void removeParticipant(const std::string& participant_name);
+
+        /// the participant is alive now, unknown participants are ignored
+        void alive(const std::string& participant_name);
+        void updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event) override;
+
+        /// @return the running state, offline for unknown participants
+        ParticipantRunningState getRunningState(const std::string& participant_name) const;
+
+        void setLivelinessTimeout(std::chrono::nanoseconds liveliness_timeout);
+        std::chrono::nanoseconds getLivelinessTimeout() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        struct Participant
+        {
+            /// default if there was no update event yet
+            Clock::time_point _last_alive_time;
+            ParticipantRunningState _running_state = ParticipantRunningState::offline;
+        };
+        using Transitions = std::vector<std::pair<std::string, ParticipantRunningState>>;
+
+        void run();
+        void notify(const Transitions& transitions) const;
+
+        const TransitionCallback _transition_callback;
+        mutable std::mutex _sync;
+        std::condition_variable _wakeup;
+        std::unordered_map<std::string, Participant> _participants;
+        TimerWheel _timers;
+        std::chrono::nanoseconds _liveliness_timeout;
+        bool _stop = false;
+        std::thread _thread;
+    };
+}
@@ -23,37 +23,87 @@ You may add additional accurate notices of copyright ownership.
 #include "fep_system/system_logger_intf.h"
 #include "fep_system/healthiness_types.h"
 #include "fep_system/rpc_component_proxy.h"
+#include "compact_jobs_health.h"
+#include "health_fetch_queue.h"
+#include "health_history.h"
+#include "simulation_progress_monitor.h"
 #include <tuple>
 #include <mutex>
 #include <functional>
+#include <memory>
 
 
 namespace fep3
 {
-    class ParticipantHealthListener : public fep3::IServiceBus::IServiceUpdateEventSink
+    /// @return a new health version, greater than all versions before (process wide)
+    uint64_t nextHealthVersion();
+    /// @return the greatest health version so far
+    uint64_t currentHealthVersion();
+
+    /**
+     * @brief Immutable health of a participant, replaced as a whole on every update.
+     */
+    struct ParticipantHealthSnapshot
+    {
+        /// changes only if the jobs health changes
+        uint64_t version = 0;
+        /// time of the last notify alive message
+        std::chrono::time_point<std::chrono::steady_clock> system_time;
+        /// shared by all snapshots with the same version
+        std::shared_ptr<const CompactJobsHealth> jobs_health = std::make_shared<CompactJobsHealth>();
+    };
+
+    class ParticipantHealthListener : public fep3::IServiceBus::IServiceUpdateEventSink, public IHealthFetchClient
     {
     public:
         using LoggingFunction = std::function<void(LoggerSeverity, const std::string&)>;
 
+        /**
+         * @param[in] fetch_queue the queue fetching the health asynchronously,
+         *                        if empty the health is fetched within @ref updateEvent
+         * @param[in] simulation_progress_monitor the monitor of the system, updated on every fetch,
+         *                                        if empty the listener uses a monitor of its own
+         */
         ParticipantHealthListener(
             fep3::rpc::IRPCHealthService* rpc_health_service,
             const std::string& participant_name,
             const std::string& system_name,
-            LoggingFunction logging_function);
+            LoggingFunction logging_function,
+            std::shared_ptr<HealthFetchQueue> fetch_queue = {},
+            std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor = {});
+        ~ParticipantHealthListener();
 
         void updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event) override;
+        void fetchHealth() override;
 
         ParticipantHealthUpdate getParticipantHealth() const;
+        /// the jobs healthiness is only filled if it changed since @p version
+        ParticipantHealthUpdate getParticipantHealthSince(uint64_t version) const;
+        /// never blocks, not even while an update is published
+        std::shared_ptr<const ParticipantHealthSnapshot> getHealthSnapshot() const;
+        /// records a sample on every fetch, empty until a capacity is set
+        HealthHistory& getHealthHistory();
+        const HealthHistory& getHealthHistory() const;
 
 
         void deactivateLogging();
     private:
         fep3::rpc::IRPCHealthService* _rpc_health_service;
-        ParticipantHealthUpdate _participant_health;
+        /// set if the health service decodes into the compact representation directly
+        const ICompactHealthSource* _compact_health_source;
+        /// accessed with std::atomic_load and std::atomic_store only
+        std::shared_ptr<const ParticipantHealthSnapshot> _snapshot = std::make_shared<ParticipantHealthSnapshot>();
+        /// serializes the writers, readers do not lock
         mutable std::mutex _health_mutex;
+        HealthHistory _health_history;
         LoggingFunction _logging_function;
         const std::string _participant_name;
         const std::string _system_name;
+        /// built once, not on every heartbeat
+        const std::string _update_event_message;
         bool _logging_active = true;
+        std::shared_ptr<HealthFetchQueue> _fetch_queue;
+        /// shared by all listeners of the system, updated on every fetch
+        std::shared_ptr<SimulationProgressMonitor> _simulation_progress_monitor;
     };
 }
@@ -0,0 +1,79 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fep3
+{
+    /**
+     * @brief Receives the service update events of one system access and forwards every event
+     * only to the sinks registered for its system and participant name.
+     * Looking the sinks up in a hash map costs O(1) per event, independent of the number of participants.
+     */
+    class ServiceUpdateDispatcher : public fep3::IServiceBus::IServiceUpdateEventSink
+    {
+    public:
+        using IServiceUpdateEventSink = fep3::IServiceBus::IServiceUpdateEventSink;
+
+        /**
+         * @brief Registers a sink for the events of one participant.
+         * Registering the same sink twice for the same participant has no effect.
+         */
+        void registerSink(const std::string& system_name, const std::string& participant_name, IServiceUpdateEventSink* sink);
+
+        /**
+         * @brief Deregisters a sink. Returns not before a concurrent delivery to the sink has finished,
+         * unless called from within the delivery to the sink itself.
+         */
+        void deregisterSink(const std::string& system_name, const std::string& participant_name, IServiceUpdateEventSink* sink);
+
+        void updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event) override;
+
+    private:
+        /// a registered sink, called without holding the lock of the dispatcher
+        struct Slot
+        {
+            explicit Slot(IServiceUpdateEventSink* sink) : _sink(sink)
+            {
+            }
+            IServiceUpdateEventSink* const _sink;
+            /// recursive, since a sink may deregister itself within updateEvent
+            std::recursive_mutex _sync;
+            bool _active = true;
+        };
+        using Sinks = std::vector<std::shared_ptr<Slot>>;
+        /// sinks by participant name by system name, two lookups without creating any key
+        std::unordered_map<std::string, std::unordered_map<std::string, Sinks>> _sinks;
+        std::shared_mutex _sync;
+    };
+
+    /**
+     * @brief Gets the dispatcher of a system access, it is created and registered at the system access
+     * on first use and deregistered when the last user releases it.
+     */
+    std::shared_ptr<ServiceUpdateDispatcher> getServiceUpdateDispatcher(
+        const std::shared_ptr<fep3::IServiceBus::ISystemAccess>& system_access);
+}
@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include "fep_system/healthiness_types.h"
+#include "compact_jobs_health.h"
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+namespace fep3
+{
+    /**
+     * @brief Derives the real time factor of the participants of one system and their lag behind the
+     * participant with the latest simulation time from the health fetched anyway, without any extra request.
+     * The statistics are updated incrementally with every fetched health, the sums of the means are
+     * computed from scratch now and then to drop accumulated rounding errors.
+     * The monitor is owned by the system and shared with the health listeners of its participants.
+     */
+    class SimulationProgressMonitor
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Updates the progress of a participant by the latest simulation time of its jobs,
+         * a participant without jobs is ignored.
+         *
+         * @param[in] participant_name name of the participant
+         * @param[in] fetch_time the time the health was received
+         * @param[in] jobs_health the health of the participant's jobs
+         */
+        void update(const std::string& participant_name, Clock::time_point fetch_time, const CompactJobsHealth& jobs_health);
+        void update(const std::string& participant_name, Clock::time_point fetch_time, std::chrono::nanoseconds simulation_time);
+        void removeParticipant(const std::string& participant_name);
+
+        SimulationProgress getProgress() const;
+
+    private:
+        struct Participant
+        {
+            Clock::time_point _fetch_time;
+            std::chrono::nanoseconds _simulation_time{ 0 };
+            double _real_time_factor = 0.0;
+            bool _has_real_time_factor = false;
+        };
+
+        void add(const Participant& participant);
+        void subtract(const Participant& participant);
+        void recomputeSums();
+
+        mutable std::mutex _sync;
+        std::unordered_map<std::string, Participant> _participants;
+        std::multiset<double> _real_time_factors;
+        std::multiset<std::chrono::nanoseconds::rep> _simulation_times;
+        double _real_time_factor_sum = 0.0;
+        double _simulation_time_sum = 0.0;
+        size_t _updates_since_recompute = 0;
+    };
+}
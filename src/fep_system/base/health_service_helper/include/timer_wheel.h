@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fep3
+{
+    /**
+     * @brief Hierarchical timer wheel of named timers, not thread safe.
+     * Scheduling and cancelling a timer costs O(1), advancing costs O(1) per elapsed tick with expired or
+     * cascaded timers, ticks without any are skipped. Timers more than 64^4 ticks ahead expire early,
+     * at the latest possible tick, the owner has to schedule them again.
+     */
+    class TimerWheel
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit TimerWheel(std::chrono::nanoseconds resolution, Clock::time_point start = Clock::now());
+
+        /// schedules the timer @p name, replaces a timer with the same name
+        void schedule(const std::string& name, Clock::time_point expiry_time);
+        /// @return @c true if the timer @p name was scheduled
+        bool cancel(const std::string& name);
+
+        /// @return the names of the timers expired until @p now
+        std::vector<std::string> advance(Clock::time_point now);
+
+        /// @return the time the wheel has to be advanced next, none if no timer is scheduled
+        std::optional<Clock::time_point> getNextAdvanceTime() const;
+
+        size_t size() const;
+
+    private:
+        static constexpr size_t slot_bits = 6;
+        static constexpr uint64_t slot_count = uint64_t(1) << slot_bits;
+        static constexpr uint64_t slot_mask = slot_count - 1;
+        static constexpr size_t level_count = 4;
+
+        struct Timer
+        {
+            uint64_t _expiry_tick;
+            size_t _level;
+            size_t _slot;
+        };
+        using Timers = std::unordered_map<std::string, Timer>;
+        /// points to the keys of @ref _timers, which are stable
+        using Slot = std::unordered_set<const std::string*>;
+
+        void insert(Timers::iterator timer);
+        void cascade(size_t level, size_t slot);
+        /// @return the next tick with expiring timers or a cascade, only valid if timers are scheduled
+        uint64_t getNextEventTick() const;
+        uint64_t toTick(Clock::time_point time) const;
+
+        const std::chrono::nanoseconds _resolution;
+        const Clock::time_point _start;
+        uint64_t _current_tick = 0;
+        Timers _timers;
+        std::array<std::array<Slot, slot_count>, level_count> _slots;
+    };
+}
@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "compact_jobs_health.h"
+#include "string_pool.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace fep3
+{
+    namespace
+    {
+        const std::string* internHealthString(std::string_view value)
+        {
+            static StringPool pool;
+            return pool.intern(value);
+        }
+    }
+
+    void CompactJobsHealth::clear()
+    {
+        _counters.clear();
+        _strings.clear();
+        _trigger_signals.clear();
+        _error_descriptions.clear();
+    }
+
+    void CompactJobsHealth::reserve(size_t job_count)
+    {
+        _counters.reserve(job_count * counters_per_job);
+        _strings.reserve(job_count * strings_per_job);
+        _error_descriptions.reserve(job_count * execute_steps);
+    }
+
+    size_t CompactJobsHealth::getJobCount() const
+    {
+        return _counters.size() / counters_per_job;
+    }
+
+    const std::string& CompactJobsHealth::getJobName(size_t job) const
+    {
+        return *_strings[job * strings_per_job + job_name];
+    }
+
+    std::chrono::nanoseconds CompactJobsHealth::getSimulationTime(size_t job) const
+    {
+        return std::chrono::nanoseconds(counter(job, simulation_time));
+    }
+
+    uint64_t CompactJobsHealth::getErrorCount(size_t job, ExecuteStep step) const
+    {
+        const auto first_counter = first_execute_error + static_cast<size_t>(step) * counters_per_error;
+        return static_cast<uint64_t>(counter(job, first_counter + error_count));
+    }
+
+    void CompactJobsHealth::addClockTriggeredJob(std::string_view job_name,
+        std::chrono::nanoseconds cycle_time,
+        std::chrono::nanoseconds simulation_time)
+    {
+        addJob(job_name, true, cycle_time, simulation_time);
+    }
+
+    void CompactJobsHealth::addDataTriggeredJob(std::string_view job_name, std::chrono::nanoseconds simulation_time)
+    {
+        addJob(job_name, false, std::chrono::nanoseconds(0), simulation_time);
+    }
+
+    void CompactJobsHealth::addTriggerSignal(std::string_view signal_name)
+    {
+        _trigger_signals.push_back(internHealthString(signal_name));
+        ++counter(getJobCount() - 1, trigger_signals_count);
+    }
+
+    void CompactJobsHealth::setExecuteError(ExecuteStep step,
+        uint64_t error_count_value,
+        std::chrono::nanoseconds simulation_time_value,
+        int error_code_value,
+        std::string_view error_description,
+        std::int32_t line,
+        std::string_view file,
+        std::string_view function)
+    {
+        const auto job = getJobCount() - 1;
+        const auto step_index = static_cast<size_t>(step);
+        const auto first_counter = first_execute_error + step_index * counters_per_error;
+        counter(job, first_counter + error_count) = static_cast<std::int64_t>(error_count_value);
+        counter(job, first_counter + error_simulation_time) = simulation_time_value.count();
+        counter(job, first_counter + error_code) = error_code_value;
+        counter(job, first_counter + error_line) = line;
+
+        const auto first_string = job * strings_per_job + first_error_location + step_index * strings_per_error;
+        _strings[first_string + error_file] = internHealthString(file);
+        _strings[first_string + error_function] = internHealthString(function);
+        _error_descriptions[job * execute_steps + step_index] = error_description;
+    }
+
+    void CompactJobsHealth::assign(const JobsHealthiness& jobs_healthiness)
+    {
+        clear();
+        reserve(jobs_healthiness.size());
+        for (const auto& job_healthiness : jobs_healthiness)
+        {
+            if (const auto clock_info = std::get_if<JobHealthiness::ClockTriggeredJobInfo>(&job_healthiness.job_info))
+            {
+                addClockTriggeredJob(job_healthiness.job_name, clock_info->cycle_time, job_healthiness.simulation_time);
+            }
+            else
+            {
+                addDataTriggeredJob(job_healthiness.job_name, job_healthiness.simulation_time);
+                for (const auto& signal_name : std::get<JobHealthiness::DataTriggeredJobInfo>(job_healthiness.job_info).trigger_signals)
+                {
+                    addTriggerSignal(signal_name);
+                }
+            }
+            const std::pair<ExecuteStep, const JobHealthiness::ExecuteError*> execute_errors[] = {
+                { ExecuteStep::data_in, &job_healthiness.execute_data_in_error },
+                { ExecuteStep::execute, &job_healthiness.execute_error },
+                { ExecuteStep::data_out, &job_healthiness.execute_data_out_error } };
+            for (const auto& [step, execute_error] : execute_errors)
+            {
+                setExecuteError(step,
+                    execute_error->error_count,
+                    execute_error->simulation_time,
+                    execute_error->last_error.error_code,
+                    execute_error->last_error.error_description,
+                    execute_error->last_error.line,
+                    execute_error->last_error.file,
+                    execute_error->last_error.function);
+            }
+        }
+    }
+
+    JobsHealthiness CompactJobsHealth::toJobsHealthiness() const
+    {
+        JobsHealthiness jobs_healthiness;
+        jobs_healthiness.reserve(getJobCount());
+        for (size_t job = 0; job < getJobCount(); ++job)
+        {
+            std::variant<JobHealthiness::ClockTriggeredJobInfo, JobHealthiness::DataTriggeredJobInfo> job_info;
+            if (counter(job, clock_triggered))
+            {
+                job_info = JobHealthiness::ClockTriggeredJobInfo{ std::chrono::nanoseconds(counter(job, cycle_time)) };
+            }
+            else
+            {
+                const auto begin = _trigger_signals.begin() + counter(job, trigger_signals_begin);
+                std::vector<std::string> trigger_signals;
+                trigger_signals.reserve(static_cast<size_t>(counter(job, trigger_signals_count)));
+                std::transform(begin, begin + counter(job, trigger_signals_count), std::back_inserter(trigger_signals),
+                    [](const std::string* signal_name) { return *signal_name; });
+                job_info = JobHealthiness::DataTriggeredJobInfo{ std::move(trigger_signals) };
+            }
+            jobs_healthiness.push_back(JobHealthiness{ *_strings[job * strings_per_job + job_name],
+                std::move(job_info),
+                std::chrono::nanoseconds(counter(job, simulation_time)),
+                toExecuteError(job, ExecuteStep::data_in),
+                toExecuteError(job, ExecuteStep::execute),
+                toExecuteError(job, ExecuteStep::data_out) });
+        }
+        return jobs_healthiness;
+    }
+
+    bool CompactJobsHealth::operator==(const CompactJobsHealth& other) const
+    {
+        // the strings are interned, so comparing their addresses is enough
+        return _counters == other._counters
+            && _strings == other._strings
+            && _trigger_signals == other._trigger_signals
+            && _error_descriptions == other._error_descriptions;
+    }
+
+    bool CompactJobsHealth::operator!=(const CompactJobsHealth& other) const
+    {
+        return !(*this == other);
+    }
+
+    void CompactJobsHealth::addJob(std::string_view job_name_value,
+        bool clock_triggered_value,
+        std::chrono::nanoseconds cycle_time_value,
+        std::chrono::nanoseconds simulation_time_value)
+    {
+        const auto empty = internHealthString({});
+        _counters.resize(_counters.size() + counters_per_job, 0);
+        _strings.resize(_strings.size() + strings_per_job, empty);
+        _error_descriptions.resize(_error_descriptions.size() + execute_steps);
+
+        const auto job = getJobCount() - 1;
+        _strings[job * strings_per_job + job_name] = internHealthString(job_name_value);
+        counter(job, clock_triggered) = clock_triggered_value ? 1 : 0;
+        counter(job, cycle_time) = cycle_time_value.count();
+        counter(job, simulation_time) = simulation_time_value.count();
+        counter(job, trigger_signals_begin) = static_cast<std::int64_t>(_trigger_signals.size());
+    }
+
+    std::int64_t& CompactJobsHealth::counter(size_t job, size_t index)
+    {
+        return _counters[job * counters_per_job + index];
+    }
+
+    std::int64_t CompactJobsHealth::counter(size_t job, size_t index) const
+    {
+        return _counters[job * counters_per_job + index];
+    }
+
+    JobHealthiness::ExecuteError CompactJobsHealth::toExecuteError(size_t job, ExecuteStep step) const
+    {
+        const auto step_index = static_cast<size_t>(step);
+        const auto first_counter = first_execute_error + step_index * counters_per_error;
+        const auto first_string = job * strings_per_job + first_error_location + step_index * strings_per_error;
+        return JobHealthiness::ExecuteError{ static_cast<uint64_t>(counter(job, first_counter + error_count)),
+            std::chrono::nanoseconds(counter(job, first_counter + error_simulation_time)),
+            JobHealthiness::ExecuteResult{ static_cast<int>(counter(job, first_counter + error_code)),
+                _error_descriptions[job * execute_steps + step_index],
+                static_cast<std::int32_t>(counter(job, first_counter + error_line)),
+                *_strings[first_string + error_file],
+                *_strings[first_string + error_function] } };
+    }
+}
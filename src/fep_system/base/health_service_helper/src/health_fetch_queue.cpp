@@ -0,0 +1,232 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "health_fetch_queue.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace fep3
+{
+    namespace
+    {
+        /// number of health RPCs running at the same time
+        constexpr size_t health_fetch_worker_count = 4;
+        /// the rate limit of a new queue, it outlives the queue
+        std::atomic<uint32_t> default_rate_limit{ 0 };
+
+        std::mutex shared_queue_sync;
+        std::weak_ptr<HealthFetchQueue> shared_queue;
+    }
+
+    HealthFetchQueue::HealthFetchQueue(size_t worker_count)
+    {
+        _workers.reserve(worker_count);
+        for (size_t index = 0; index < worker_count; ++index)
+        {
+            _workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    HealthFetchQueue::~HealthFetchQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            _stop = true;
+        }
+        _wakeup.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    void HealthFetchQueue::request(IHealthFetchClient* client)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            ++_metrics.requested;
+            if (_running_clients.count(client) > 0)
+            {
+                // queued again when the running fetch has finished
+                if (!_requested_while_running.insert(client).second)
+                {
+                    ++_metrics.coalesced;
+                }
+                return;
+            }
+            if (!_pending_clients.insert(client).second)
+            {
+                ++_metrics.coalesced;
+                return;
+            }
+            _pending.push_back(client);
+        }
+        _wakeup.notify_one();
+    }
+
+    void HealthFetchQueue::cancel(IHealthFetchClient* client)
+    {
+        std::unique_lock<std::mutex> lock(_sync);
+        // a request may arrive while waiting, so drop it after every fetch again
+        while (dropPending(client))
+        {
+            _fetch_finished.wait(lock);
+        }
+    }
+
+    bool HealthFetchQueue::isBusy(IHealthFetchClient* client) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _pending_clients.count(client) > 0 || _running_clients.count(client) > 0;
+    }
+
+    // @return true if a fetch of the client is still running
+    bool HealthFetchQueue::dropPending(IHealthFetchClient* client)
+    {
+        if (_pending_clients.erase(client) > 0)
+        {
+            _pending.erase(std::find(_pending.begin(), _pending.end(), client));
+            ++_metrics.dropped;
+        }
+        _metrics.dropped += _requested_while_running.erase(client);
+        return _running_clients.count(client) > 0;
+    }
+
+    void HealthFetchQueue::setRateLimit(uint32_t fetches_per_second)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            _rate_limit = fetches_per_second;
+        }
+        _wakeup.notify_all();
+    }
+
+    uint32_t HealthFetchQueue::getRateLimit() const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _rate_limit;
+    }
+
+    HealthFetchMetrics HealthFetchQueue::getMetrics() const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        auto metrics = _metrics;
+        metrics.pending = _pending.size();
+        return metrics;
+    }
+
+    void HealthFetchQueue::work()
+    {
+        std::unique_lock<std::mutex> lock(_sync);
+        while (true)
+        {
+            _wakeup.wait(lock, [this]() { return _stop || !_pending.empty(); });
+            if (_stop)
+            {
+                _metrics.dropped += _pending.size() + _requested_while_running.size();
+                _pending.clear();
+                _pending_clients.clear();
+                _requested_while_running.clear();
+                return;
+            }
+            if (_rate_limit > 0)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                if (now < _next_fetch_time)
+                {
+                    // the limit may change or the queue may stop in the meantime, so check again
+                    _wakeup.wait_until(lock, _next_fetch_time);
+                    continue;
+                }
+                _next_fetch_time = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::seconds(1)) / _rate_limit;
+            }
+
+            auto client = _pending.front();
+            _pending.pop_front();
+            _pending_clients.erase(client);
+            _running_clients.insert(client);
+
+            lock.unlock();
+            bool failed = false;
+            try
+            {
+                client->fetchHealth();
+            }
+            catch (...)
+            {
+                // the worker must survive, the next request of the client fetches again
+                failed = true;
+            }
+            lock.lock();
+
+            _running_clients.erase(client);
+            ++_metrics.fetched;
+            if (failed)
+            {
+                ++_metrics.failed;
+            }
+            if (_requested_while_running.erase(client) > 0)
+            {
+                _pending_clients.insert(client);
+                _pending.push_back(client);
+                _wakeup.notify_one();
+            }
+            _fetch_finished.notify_all();
+        }
+    }
+
+    std::shared_ptr<HealthFetchQueue> getHealthFetchQueue()
+    {
+        std::lock_guard<std::mutex> lock(shared_queue_sync);
+        auto queue = shared_queue.lock();
+        if (!queue)
+        {
+            queue = std::make_shared<HealthFetchQueue>(health_fetch_worker_count);
+            queue->setRateLimit(default_rate_limit);
+            shared_queue = queue;
+        }
+        return queue;
+    }
+
+    void setHealthFetchRateLimit(uint32_t fetches_per_second)
+    {
+        std::lock_guard<std::mutex> lock(shared_queue_sync);
+        default_rate_limit = fetches_per_second;
+        if (auto queue = shared_queue.lock())
+        {
+            queue->setRateLimit(fetches_per_second);
+        }
+    }
+
+    uint32_t getHealthFetchRateLimit()
+    {
+        return default_rate_limit;
+    }
+
+    HealthFetchMetrics getHealthFetchMetrics()
+    {
+        std::lock_guard<std::mutex> lock(shared_queue_sync);
+        if (auto queue = shared_queue.lock())
+        {
+            return queue->getMetrics();
+        }
+        return {};
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "health_history.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace fep3
+{
+    namespace
+    {
+        /// a counter which decreased was reset, it counts from zero again
+        template<typename T>
+        T getIncrement(T previous, T current)
+        {
+            return current >= previous ? current - previous : current;
+        }
+
+        const std::array<CompactJobsHealth::ExecuteStep, 3> execute_steps{
+            CompactJobsHealth::ExecuteStep::data_in,
+            CompactJobsHealth::ExecuteStep::execute,
+            CompactJobsHealth::ExecuteStep::data_out };
+    }
+
+    HealthHistory::HealthHistory(size_t capacity) : _samples(capacity)
+    {
+    }
+
+    void HealthHistory::setCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        if (capacity == _samples.size())
+        {
+            return;
+        }
+        const auto kept = std::min(_size, capacity);
+        std::vector<Sample> samples(capacity);
+        for (size_t index = 0; index < kept; ++index)
+        {
+            samples[index] = std::move(_samples[getSlot(_size - kept + index)]);
+        }
+        _samples = std::move(samples);
+        _size = kept;
+        _next = capacity == 0 ? 0 : kept % capacity;
+    }
+
+    size_t HealthHistory::getCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _samples.size();
+    }
+
+    void HealthHistory::record(Clock::time_point system_time, const CompactJobsHealth& jobs_health)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        if (_samples.empty() || (_size > 0 && system_time <= at(_size - 1)._system_time))
+        {
+            return;
+        }
+
+        // the slot keeps its memory, so a full buffer does not allocate
+        auto& sample = _samples[_next];
+        sample._system_time = system_time;
+        sample._simulation_time = std::chrono::nanoseconds(0);
+        sample._job_error_counts.clear();
+        sample._error_count = 0;
+        for (size_t job = 0; job < jobs_health.getJobCount(); ++job)
+        {
+            sample._simulation_time = std::max(sample._simulation_time, jobs_health.getSimulationTime(job));
+            uint64_t error_count = 0;
+            for (const auto step : execute_steps)
+            {
+                error_count += jobs_health.getErrorCount(job, step);
+            }
+            sample._job_error_counts.emplace_back(&jobs_health.getJobName(job), error_count);
+            sample._error_count += error_count;
+        }
+
+        _next = (_next + 1) % _samples.size();
+        _size = std::min(_size + 1, _samples.size());
+    }
+
+    std::vector<ParticipantHealthSample> HealthHistory::getSamples(Clock::time_point since) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        std::vector<ParticipantHealthSample> samples;
+        for (auto index = findFirst(since); index < _size; ++index)
+        {
+            const auto& sample = at(index);
+            ParticipantHealthSample health_sample{ sample._system_time, sample._simulation_time, {} };
+            for (const auto& [job_name, error_count] : sample._job_error_counts)
+            {
+                health_sample.jobs_error_count.emplace(*job_name, error_count);
+            }
+            samples.push_back(std::move(health_sample));
+        }
+        return samples;
+    }
+
+    ParticipantHealthRates HealthHistory::getRates(Clock::time_point since) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        ParticipantHealthRates rates;
+        const auto first = findFirst(since);
+        rates.sample_count = _size - first;
+        if (rates.sample_count < 2)
+        {
+            return rates;
+        }
+
+        uint64_t errors = 0;
+        std::chrono::nanoseconds simulation_time{ 0 };
+        for (auto index = first + 1; index < _size; ++index)
+        {
+            errors += getIncrement(at(index - 1)._error_count, at(index)._error_count);
+            simulation_time += getIncrement(at(index - 1)._simulation_time, at(index)._simulation_time);
+        }
+        const auto wall_time = at(_size - 1)._system_time - at(first)._system_time;
+        const auto wall_seconds = std::chrono::duration<double>(wall_time).count();
+        rates.errors_per_second = static_cast<double>(errors) / wall_seconds;
+        rates.simulation_time_per_second = std::chrono::duration<double>(simulation_time).count() / wall_seconds;
+
+        const auto interval_count = rates.sample_count - 1;
+        const auto mean_interval = std::chrono::duration<double, std::nano>(wall_time).count() / interval_count;
+        double squared_deviations = 0.0;
+        for (auto index = first + 1; index < _size; ++index)
+        {
+            const auto interval = std::chrono::duration<double, std::nano>(at(index)._system_time - at(index - 1)._system_time).count();
+            squared_deviations += (interval - mean_interval) * (interval - mean_interval);
+        }
+        rates.mean_heartbeat_interval = std::chrono::nanoseconds(static_cast<int64_t>(mean_interval));
+        rates.heartbeat_jitter = std::chrono::nanoseconds(static_cast<int64_t>(std::sqrt(squared_deviations / interval_count)));
+        return rates;
+    }
+
+    size_t HealthHistory::getSlot(size_t index) const
+    {
+        // the oldest sample is the next one to overwrite if full
+        const auto oldest = (_next + _samples.size() - _size) % _samples.size();
+        return (oldest + index) % _samples.size();
+    }
+
+    const HealthHistory::Sample& HealthHistory::at(size_t index) const
+    {
+        return _samples[getSlot(index)];
+    }
+
+    size_t HealthHistory::findFirst(Clock::time_point since) const
+    {
+        // the samples are ordered by time
+        size_t begin = 0;
+        size_t end = _size;
+        while (begin < end)
+        {
+            const auto middle = begin + (end - begin) / 2;
+            if (at(middle)._system_time < since)
+            {
+                begin = middle + 1;
+            }
+            else
+            {
+                end = middle;
+            }
+        }
+        return begin;
+    }
+}
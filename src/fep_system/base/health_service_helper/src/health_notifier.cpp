@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "health_notifier.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+
+namespace fep3
+{
+    namespace
+    {
+        struct HealthUpdateSignal
+        {
+            std::mutex _sync;
+            std::condition_variable _updated;
+            uint64_t _update_count = 0;
+            /// lets the health listeners skip the signal if no notifier is running
+            std::atomic<size_t> _waiting_notifiers{ 0 };
+        };
+
+        HealthUpdateSignal& getHealthUpdateSignal()
+        {
+            static HealthUpdateSignal signal;
+            return signal;
+        }
+    }
+
+    void signalHealthUpdate()
+    {
+        auto& signal = getHealthUpdateSignal();
+        if (signal._waiting_notifiers == 0)
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(signal._sync);
+            ++signal._update_count;
+        }
+        signal._updated.notify_all();
+    }
+
+    HealthNotifier::HealthNotifier(HealthQuery query) : _query(std::move(query))
+    {
+    }
+
+    HealthNotifier::~HealthNotifier()
+    {
+        auto& signal = getHealthUpdateSignal();
+        {
+            std::lock_guard<std::mutex> lock(signal._sync);
+            _stop = true;
+        }
+        signal._updated.notify_all();
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    void HealthNotifier::registerMonitor(IHealthMonitor* monitor)
+    {
+        {
+            std::lock_guard<std::recursive_mutex> lock(_monitors_sync);
+            if (std::find(_monitors.begin(), _monitors.end(), monitor) == _monitors.end())
+            {
+                _monitors.push_back(monitor);
+            }
+        }
+        std::lock_guard<std::mutex> lock(getHealthUpdateSignal()._sync);
+        if (!_thread.joinable())
+        {
+            _thread = std::thread(&HealthNotifier::run, this);
+        }
+    }
+
+    void HealthNotifier::unregisterMonitor(IHealthMonitor* monitor)
+    {
+        // waits for a running delivery
+        std::lock_guard<std::recursive_mutex> lock(_monitors_sync);
+        _monitors.erase(std::remove(_monitors.begin(), _monitors.end(), monitor), _monitors.end());
+    }
+
+    void HealthNotifier::setBatchInterval(std::chrono::milliseconds batch_interval)
+    {
+        std::lock_guard<std::mutex> lock(getHealthUpdateSignal()._sync);
+        _batch_interval = std::max(batch_interval, std::chrono::milliseconds(0));
+    }
+
+    std::chrono::milliseconds HealthNotifier::getBatchInterval() const
+    {
+        std::lock_guard<std::mutex> lock(getHealthUpdateSignal()._sync);
+        return _batch_interval;
+    }
+
+    void HealthNotifier::run()
+    {
+        auto& signal = getHealthUpdateSignal();
+        ++signal._waiting_notifiers;
+        std::unique_lock<std::mutex> lock(signal._sync);
+        // taken before the first query, so no update afterwards is missed
+        uint64_t seen_update_count = signal._update_count;
+        lock.unlock();
+
+        // the health before the thread started is not reported as a change
+        uint64_t version = 0;
+        try
+        {
+            version = _query(std::numeric_limits<uint64_t>::max()).version;
+        }
+        catch (const std::exception&)
+        {
+            // the health listeners are deactivated, nothing is reported until they are activated
+        }
+
+        lock.lock();
+        while (!_stop)
+        {
+            signal._updated.wait(lock, [&]() { return _stop || signal._update_count != seen_update_count; });
+            if (!_stop && _batch_interval.count() > 0)
+            {
+                signal._updated.wait_for(lock, _batch_interval, [&]() { return _stop; });
+            }
+            if (_stop)
+            {
+                break;
+            }
+            seen_update_count = signal._update_count;
+            lock.unlock();
+
+            ParticipantsHealthChanges changes;
+            try
+            {
+                changes = _query(version);
+                version = changes.version;
+            }
+            catch (const std::exception&)
+            {
+                // the health listeners are deactivated, the changes are reported once they are activated again
+            }
+            if (!changes.participants_health.empty())
+            {
+                deliver(changes.participants_health);
+            }
+
+            lock.lock();
+        }
+        --signal._waiting_notifiers;
+    }
+
+    void HealthNotifier::deliver(const std::map<std::string, ParticipantHealth>& participants_health)
+    {
+        std::lock_guard<std::recursive_mutex> lock(_monitors_sync);
+        // a copy, the monitors may unregister within their callback
+        const auto monitors = _monitors;
+        for (auto* monitor : monitors)
+        {
+            if (std::find(_monitors.begin(), _monitors.end(), monitor) != _monitors.end())
+            {
+                try
+                {
+                    monitor->onHealthChanged(participants_health);
+                }
+                catch (...)
+                {
+                    // a failing monitor must neither stop the dispatcher thread nor the other monitors
+                }
+            }
+        }
+    }
+}
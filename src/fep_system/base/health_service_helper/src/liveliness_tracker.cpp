@@ -0,0 +1,221 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "liveliness_tracker.h"
+
+namespace fep3
+{
+    namespace
+    {
+        /// offline transitions are reported at most this late
+        constexpr std::chrono::milliseconds timer_resolution{ 1 };
+    }
+
+    LivelinessTracker::LivelinessTracker(std::chrono::nanoseconds liveliness_timeout,
+        TransitionCallback transition_callback)
+        : _transition_callback(std::move(transition_callback)),
+          _timers(timer_resolution),
+          _liveliness_timeout(liveliness_timeout)
+    {
+        _thread = std::thread(&LivelinessTracker::run, this);
+    }
+
+    LivelinessTracker::~LivelinessTracker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            _stop = true;
+        }
+        _wakeup.notify_all();
+        _thread.join();
+    }
+
+    void LivelinessTracker::addParticipant(const std::string& participant_name, Clock::time_point last_alive_time)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            auto& participant = _participants.emplace(participant_name, Participant{}).first->second;
+            participant._last_alive_time = last_alive_time;
+            const auto now = Clock::now();
+            const auto offline_time = last_alive_time + _liveliness_timeout;
+            if (last_alive_time == Clock::time_point{} || offline_time <= now)
+            {
+                return;
+            }
+            participant._running_state = ParticipantRunningState::online;
+            if (_timers.size() == 0)
+            {
+                // moves the idle wheel to now, nothing expires
+                _timers.advance(now);
+            }
+            _timers.schedule(participant_name, offline_time);
+        }
+        _wakeup.notify_all();
+    }
+
+    void LivelinessTracker::removeParticipant(const std::string& participant_name)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        _participants.erase(participant_name);
+        _timers.cancel(participant_name);
+    }
+
+    void LivelinessTracker::alive(const std::string& participant_name)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            const auto participant = _participants.find(participant_name);
+            if (participant == _participants.end())
+            {
+                return;
+            }
+            const auto now = Clock::now();
+            participant->second._last_alive_time = now;
+            // the timer of an online participant is scheduled again when it expires
+            if (participant->second._running_state == ParticipantRunningState::online)
+            {
+                return;
+            }
+            participant->second._running_state = ParticipantRunningState::online;
+            if (_timers.size() == 0)
+            {
+                // moves the idle wheel to now, nothing expires
+                _timers.advance(now);
+            }
+            _timers.schedule(participant_name, now + _liveliness_timeout);
+        }
+        _wakeup.notify_all();
+        notify({ { participant_name, ParticipantRunningState::online } });
+    }
+
+    void LivelinessTracker::updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event)
+    {
+        alive(service_update_event.service_name);
+    }
+
+    ParticipantRunningState LivelinessTracker::getRunningState(const std::string& participant_name) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        const auto participant = _participants.find(participant_name);
+        if (participant == _participants.end())
+        {
+            return ParticipantRunningState::offline;
+        }
+        return participant->second._running_state;
+    }
+
+    void LivelinessTracker::setLivelinessTimeout(std::chrono::nanoseconds liveliness_timeout)
+    {
+        Transitions transitions;
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            _liveliness_timeout = liveliness_timeout;
+            // the timers may expire too late now, all states are evaluated again with the new timeout
+            const auto now = Clock::now();
+            for (auto& [participant_name, participant] : _participants)
+            {
+                if (participant._last_alive_time == Clock::time_point{})
+                {
+                    continue;
+                }
+                const auto offline_time = participant._last_alive_time + _liveliness_timeout;
+                const auto running_state = offline_time > now
+                    ? ParticipantRunningState::online
+                    : ParticipantRunningState::offline;
+                if (running_state == ParticipantRunningState::online)
+                {
+                    _timers.schedule(participant_name, offline_time);
+                }
+                else
+                {
+                    _timers.cancel(participant_name);
+                }
+                if (running_state != participant._running_state)
+                {
+                    participant._running_state = running_state;
+                    transitions.emplace_back(participant_name, running_state);
+                }
+            }
+        }
+        _wakeup.notify_all();
+        notify(transitions);
+    }
+
+    std::chrono::nanoseconds LivelinessTracker::getLivelinessTimeout() const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _liveliness_timeout;
+    }
+
+    void LivelinessTracker::run()
+    {
+        std::unique_lock<std::mutex> lock(_sync);
+        while (!_stop)
+        {
+            const auto next_advance_time = _timers.getNextAdvanceTime();
+            if (next_advance_time)
+            {
+                _wakeup.wait_until(lock, *next_advance_time);
+            }
+            else
+            {
+                _wakeup.wait(lock);
+            }
+            if (_stop)
+            {
+                break;
+            }
+
+            Transitions transitions;
+            const auto now = Clock::now();
+            for (const auto& participant_name : _timers.advance(now))
+            {
+                auto& participant = _participants.at(participant_name);
+                const auto offline_time = participant._last_alive_time + _liveliness_timeout;
+                if (offline_time > now)
+                {
+                    // alive since the timer was scheduled
+                    _timers.schedule(participant_name, offline_time);
+                }
+                else
+                {
+                    participant._running_state = ParticipantRunningState::offline;
+                    transitions.emplace_back(participant_name, ParticipantRunningState::offline);
+                }
+            }
+            if (!transitions.empty())
+            {
+                lock.unlock();
+                notify(transitions);
+                lock.lock();
+            }
+        }
+    }
+
+    void LivelinessTracker::notify(const Transitions& transitions) const
+    {
+        if (!_transition_callback)
+        {
+            return;
+        }
+        for (const auto& [participant_name, running_state] : transitions)
+        {
+            _transition_callback(participant_name, running_state);
+        }
+    }
+}
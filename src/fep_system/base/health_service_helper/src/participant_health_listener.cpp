@@ -17,19 +17,44 @@ You may add additional accurate notices of copyright ownership.
 @endverbatim
  */
 #include "participant_health_listener.h"
+#include "health_notifier.h"
+
+#include <atomic>
+
 namespace fep3
 {
+    namespace
+    {
+        std::atomic<uint64_t> health_version{ 0 };
+    }
+
+    uint64_t nextHealthVersion()
+    {
+        return ++health_version;
+    }
+
+    uint64_t currentHealthVersion()
+    {
+        return health_version;
+    }
 
 
     ParticipantHealthListener::ParticipantHealthListener(
         fep3::rpc::IRPCHealthService* rpc_health_service,
         const std::string& participant_name,
         const std::string& system_name,
-        LoggingFunction logging_function)
+        LoggingFunction logging_function,
+        std::shared_ptr<HealthFetchQueue> fetch_queue,
+        std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor)
         : _rpc_health_service(rpc_health_service)
+        , _compact_health_source(dynamic_cast<const ICompactHealthSource*>(rpc_health_service))
         , _participant_name(participant_name)
         , _system_name(system_name)
+        , _update_event_message("Received update event from " + participant_name)
         , _logging_function(std::move(logging_function))
+        , _fetch_queue(std::move(fetch_queue))
+        , _simulation_progress_monitor(simulation_progress_monitor ?
+            std::move(simulation_progress_monitor) : std::make_shared<SimulationProgressMonitor>())
     {
         if (!_rpc_health_service)
         {
@@ -37,32 +62,104 @@ namespace fep3
         }
     }
 
+    ParticipantHealthListener::~ParticipantHealthListener()
+    {
+        if (_fetch_queue)
+        {
+            _fetch_queue->cancel(this);
+        }
+        _simulation_progress_monitor->removeParticipant(_participant_name);
+    }
+
     void ParticipantHealthListener::updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event)
     {
-        // do not lock the rpc call
         if ((_participant_name == service_update_event.service_name) &&
             (_system_name == service_update_event.system_name) &&
             _rpc_health_service)
         {
             {
-                auto jobs_healthiness = _rpc_health_service->getHealth();
+                // the participant is alive now, even if its health is fetched later
                 std::lock_guard<std::mutex> lock(_health_mutex);
-                _participant_health.system_time = std::chrono::steady_clock::now();
-                _participant_health.jobs_healthiness = std::move(jobs_healthiness);
-                if (_logging_active)
-                {
-                    _logging_function(LoggerSeverity::debug, "Received update event from " + _participant_name);
-                }
+                auto snapshot = std::make_shared<ParticipantHealthSnapshot>(*std::atomic_load(&_snapshot));
+                snapshot->system_time = std::chrono::steady_clock::now();
+                std::atomic_store(&_snapshot, std::shared_ptr<const ParticipantHealthSnapshot>(std::move(snapshot)));
+            }
+            // do not block the service bus thread with the rpc call
+            if (_fetch_queue)
+            {
+                _fetch_queue->request(this);
+            }
+            else
+            {
+                fetchHealth();
             }
         }
     }
 
-    ParticipantHealthUpdate ParticipantHealthListener::getParticipantHealth() const
+    void ParticipantHealthListener::fetchHealth()
     {
+        // do not lock the rpc call
+        auto jobs_health = std::make_shared<CompactJobsHealth>();
+        if (_compact_health_source)
+        {
+            _compact_health_source->getCompactHealth(*jobs_health);
+        }
+        else
+        {
+            jobs_health->assign(_rpc_health_service->getHealth());
+        }
+
         std::lock_guard<std::mutex> lock(_health_mutex);
-        return _participant_health;
+        const auto current_snapshot = std::atomic_load(&_snapshot);
+        if (*current_snapshot->jobs_health != *jobs_health)
+        {
+            auto snapshot = std::make_shared<ParticipantHealthSnapshot>(*current_snapshot);
+            snapshot->version = nextHealthVersion();
+            snapshot->jobs_health = std::move(jobs_health);
+            std::atomic_store(&_snapshot, std::shared_ptr<const ParticipantHealthSnapshot>(std::move(snapshot)));
+            signalHealthUpdate();
+        }
+        // every fetch is a sample, even if the jobs did not change
+        const auto published_snapshot = std::atomic_load(&_snapshot);
+        _health_history.record(published_snapshot->system_time, *published_snapshot->jobs_health);
+        _simulation_progress_monitor->update(_participant_name, published_snapshot->system_time, *published_snapshot->jobs_health);
+        // logged after the health is available, so the message can be waited for
+        if (_logging_active)
+        {
+            _logging_function(LoggerSeverity::debug, _update_event_message);
+        }
+    }
+
+    ParticipantHealthUpdate ParticipantHealthListener::getParticipantHealth() const
+    {
+        const auto snapshot = getHealthSnapshot();
+        return ParticipantHealthUpdate{ snapshot->system_time, snapshot->jobs_health->toJobsHealthiness(), snapshot->version };
+    }
+
+    ParticipantHealthUpdate ParticipantHealthListener::getParticipantHealthSince(uint64_t version) const
+    {
+        const auto snapshot = getHealthSnapshot();
+        if (snapshot->version > version)
+        {
+            return ParticipantHealthUpdate{ snapshot->system_time, snapshot->jobs_health->toJobsHealthiness(), snapshot->version };
+        }
+        return ParticipantHealthUpdate{ snapshot->system_time, {}, snapshot->version };
+    }
+
+    std::shared_ptr<const ParticipantHealthSnapshot> ParticipantHealthListener::getHealthSnapshot() const
+    {
+        return std::atomic_load(&_snapshot);
+    }
+
+    HealthHistory& ParticipantHealthListener::getHealthHistory()
+    {
+        return _health_history;
     }
 
+    const HealthHistory& ParticipantHealthListener::getHealthHistory() const
+    {
+        return _health_history;
+    }
 
     void ParticipantHealthListener::deactivateLogging()
     {
@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "service_update_dispatcher.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace fep3
+{
+    void ServiceUpdateDispatcher::registerSink(const std::string& system_name,
+        const std::string& participant_name,
+        IServiceUpdateEventSink* sink)
+    {
+        std::unique_lock<std::shared_mutex> lock(_sync);
+        auto& sinks = _sinks[system_name][participant_name];
+        if (std::none_of(sinks.begin(), sinks.end(), [sink](const auto& slot) { return slot->_sink == sink; }))
+        {
+            sinks.push_back(std::make_shared<Slot>(sink));
+        }
+    }
+
+    void ServiceUpdateDispatcher::deregisterSink(const std::string& system_name,
+        const std::string& participant_name,
+        IServiceUpdateEventSink* sink)
+    {
+        std::shared_ptr<Slot> removed;
+        {
+            std::unique_lock<std::shared_mutex> lock(_sync);
+            const auto system = _sinks.find(system_name);
+            if (system == _sinks.end())
+            {
+                return;
+            }
+            const auto participant = system->second.find(participant_name);
+            if (participant == system->second.end())
+            {
+                return;
+            }
+            auto& sinks = participant->second;
+            const auto slot = std::find_if(sinks.begin(), sinks.end(), [sink](const auto& slot) { return slot->_sink == sink; });
+            if (slot == sinks.end())
+            {
+                return;
+            }
+            removed = *slot;
+            sinks.erase(slot);
+            if (sinks.empty())
+            {
+                system->second.erase(participant);
+                if (system->second.empty())
+                {
+                    _sinks.erase(system);
+                }
+            }
+        }
+        // waits for a running delivery to the sink, a delivery which copied the sinks before skips it
+        std::lock_guard<std::recursive_mutex> lock(removed->_sync);
+        removed->_active = false;
+    }
+
+    void ServiceUpdateDispatcher::updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event)
+    {
+        Sinks sinks;
+        {
+            std::shared_lock<std::shared_mutex> lock(_sync);
+            const auto system = _sinks.find(service_update_event.system_name);
+            if (system == _sinks.end())
+            {
+                return;
+            }
+            const auto participant = system->second.find(service_update_event.service_name);
+            if (participant == system->second.end())
+            {
+                return;
+            }
+            sinks = participant->second;
+        }
+        // the sinks are called without the lock, so they may register and deregister sinks
+        for (const auto& slot : sinks)
+        {
+            std::lock_guard<std::recursive_mutex> lock(slot->_sync);
+            if (slot->_active)
+            {
+                slot->_sink->updateEvent(service_update_event);
+            }
+        }
+    }
+
+    std::shared_ptr<ServiceUpdateDispatcher> getServiceUpdateDispatcher(
+        const std::shared_ptr<fep3::IServiceBus::ISystemAccess>& system_access)
+    {
+        static std::mutex sync;
+        static std::map<fep3::IServiceBus::ISystemAccess*, std::weak_ptr<ServiceUpdateDispatcher>> dispatchers;
+
+        std::lock_guard<std::mutex> lock(sync);
+        if (auto dispatcher = dispatchers[system_access.get()].lock())
+        {
+            return dispatcher;
+        }
+        // release the expired dispatchers of other system accesses on the way
+        for (auto entry = dispatchers.begin(); entry != dispatchers.end();)
+        {
+            if (entry->first != system_access.get() && entry->second.expired())
+            {
+                entry = dispatchers.erase(entry);
+            }
+            else
+            {
+                ++entry;
+            }
+        }
+
+        std::shared_ptr<ServiceUpdateDispatcher> dispatcher(new ServiceUpdateDispatcher(),
+            [system_access](ServiceUpdateDispatcher* dispatcher_to_delete)
+            {
+                system_access->deregisterUpdateEventSink(dispatcher_to_delete);
+                delete dispatcher_to_delete;
+            });
+        system_access->registerUpdateEventSink(dispatcher.get());
+        dispatchers[system_access.get()] = dispatcher;
+        return dispatcher;
+    }
+}
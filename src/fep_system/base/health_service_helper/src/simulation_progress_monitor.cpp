@@ -0,0 +1,170 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "simulation_progress_monitor.h"
+
+#include <algorithm>
+
+namespace fep3
+{
+    namespace
+    {
+        /// weight of the latest real time factor within the smoothed one
+        constexpr double real_time_factor_smoothing = 0.25;
+        /// the sums are recomputed after this many updates per participant
+        constexpr size_t updates_per_recompute = 64;
+    }
+
+    void SimulationProgressMonitor::update(const std::string& participant_name,
+        Clock::time_point fetch_time,
+        const CompactJobsHealth& jobs_health)
+    {
+        if (jobs_health.getJobCount() == 0)
+        {
+            return;
+        }
+        std::chrono::nanoseconds simulation_time{ 0 };
+        for (size_t job = 0; job < jobs_health.getJobCount(); ++job)
+        {
+            simulation_time = std::max(simulation_time, jobs_health.getSimulationTime(job));
+        }
+        update(participant_name, fetch_time, simulation_time);
+    }
+
+    void SimulationProgressMonitor::update(const std::string& participant_name,
+        Clock::time_point fetch_time,
+        std::chrono::nanoseconds simulation_time)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        const auto found = _participants.find(participant_name);
+        Participant participant;
+        if (found != _participants.end())
+        {
+            // fetched again without a new heartbeat, nothing to derive a real time factor from
+            if (fetch_time <= found->second._fetch_time)
+            {
+                return;
+            }
+            participant = found->second;
+            subtract(participant);
+        }
+        if (found != _participants.end() && simulation_time >= participant._simulation_time)
+        {
+            const auto real_time_factor = std::chrono::duration<double>(simulation_time - participant._simulation_time).count()
+                / std::chrono::duration<double>(fetch_time - participant._fetch_time).count();
+            participant._real_time_factor = participant._has_real_time_factor
+                ? participant._real_time_factor + real_time_factor_smoothing * (real_time_factor - participant._real_time_factor)
+                : real_time_factor;
+            participant._has_real_time_factor = true;
+        }
+        else if (simulation_time < participant._simulation_time)
+        {
+            // the simulation was restarted
+            participant._has_real_time_factor = false;
+            participant._real_time_factor = 0.0;
+        }
+        participant._fetch_time = fetch_time;
+        participant._simulation_time = simulation_time;
+        add(participant);
+        _participants[participant_name] = participant;
+
+        if (++_updates_since_recompute >= updates_per_recompute * _participants.size())
+        {
+            recomputeSums();
+        }
+    }
+
+    void SimulationProgressMonitor::removeParticipant(const std::string& participant_name)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        const auto found = _participants.find(participant_name);
+        if (found != _participants.end())
+        {
+            subtract(found->second);
+            _participants.erase(found);
+        }
+    }
+
+    SimulationProgress SimulationProgressMonitor::getProgress() const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        SimulationProgress progress;
+        if (_participants.empty())
+        {
+            return progress;
+        }
+        if (!_real_time_factors.empty())
+        {
+            progress.min_real_time_factor = *_real_time_factors.begin();
+            progress.max_real_time_factor = *_real_time_factors.rbegin();
+            progress.mean_real_time_factor = _real_time_factor_sum / static_cast<double>(_real_time_factors.size());
+        }
+        const std::chrono::nanoseconds min_simulation_time(*_simulation_times.begin());
+        const std::chrono::nanoseconds max_simulation_time(*_simulation_times.rbegin());
+        const auto mean_simulation_time = _simulation_time_sum / static_cast<double>(_simulation_times.size());
+        progress.max_lag = max_simulation_time - min_simulation_time;
+        progress.mean_lag = std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(
+            static_cast<double>(max_simulation_time.count()) - mean_simulation_time));
+
+        for (const auto& [participant_name, participant] : _participants)
+        {
+            progress.participants.emplace(participant_name, ParticipantSimulationProgress{
+                participant._simulation_time,
+                participant._real_time_factor,
+                max_simulation_time - participant._simulation_time });
+        }
+        return progress;
+    }
+
+    void SimulationProgressMonitor::add(const Participant& participant)
+    {
+        if (participant._has_real_time_factor)
+        {
+            _real_time_factors.insert(participant._real_time_factor);
+            _real_time_factor_sum += participant._real_time_factor;
+        }
+        _simulation_times.insert(participant._simulation_time.count());
+        _simulation_time_sum += static_cast<double>(participant._simulation_time.count());
+    }
+
+    void SimulationProgressMonitor::subtract(const Participant& participant)
+    {
+        if (participant._has_real_time_factor)
+        {
+            _real_time_factors.erase(_real_time_factors.find(participant._real_time_factor));
+            _real_time_factor_sum -= participant._real_time_factor;
+        }
+        _simulation_times.erase(_simulation_times.find(participant._simulation_time.count()));
+        _simulation_time_sum -= static_cast<double>(participant._simulation_time.count());
+    }
+
+    void SimulationProgressMonitor::recomputeSums()
+    {
+        _real_time_factor_sum = 0.0;
+        _simulation_time_sum = 0.0;
+        for (const auto& [participant_name, participant] : _participants)
+        {
+            if (participant._has_real_time_factor)
+            {
+                _real_time_factor_sum += participant._real_time_factor;
+            }
+            _simulation_time_sum += static_cast<double>(participant._simulation_time.count());
+        }
+        _updates_since_recompute = 0;
+    }
+}
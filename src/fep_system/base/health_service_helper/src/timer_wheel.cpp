@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+#include "timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace fep3
+{
+    TimerWheel::TimerWheel(std::chrono::nanoseconds resolution, Clock::time_point start)
+        : _resolution(std::max(resolution, std::chrono::nanoseconds(1))),
+          _start(start)
+    {
+    }
+
+    void TimerWheel::schedule(const std::string& name, Clock::time_point expiry_time)
+    {
+        cancel(name);
+        // a timer never expires within the current tick, it has been processed already
+        const auto expiry_tick = std::max(toTick(expiry_time), _current_tick + 1);
+        insert(_timers.emplace(name, Timer{ expiry_tick, 0, 0 }).first);
+    }
+
+    bool TimerWheel::cancel(const std::string& name)
+    {
+        const auto timer = _timers.find(name);
+        if (timer == _timers.end())
+        {
+            return false;
+        }
+        _slots[timer->second._level][timer->second._slot].erase(&timer->first);
+        _timers.erase(timer);
+        return true;
+    }
+
+    std::vector<std::string> TimerWheel::advance(Clock::time_point now)
+    {
+        std::vector<std::string> expired;
+        const auto target_tick = toTick(now);
+        while (!_timers.empty())
+        {
+            const auto next_tick = getNextEventTick();
+            if (next_tick > target_tick)
+            {
+                break;
+            }
+            _current_tick = next_tick;
+
+            // cascaded timers expiring within this tick are moved to the lowest level before it is processed
+            const auto slot = _current_tick & slot_mask;
+            for (size_t level = 1; level < level_count && (_current_tick & ((uint64_t(1) << (slot_bits * level)) - 1)) == 0; ++level)
+            {
+                cascade(level, (_current_tick >> (slot_bits * level)) & slot_mask);
+            }
+
+            auto& due = _slots[0][slot];
+            for (const auto* name : due)
+            {
+                expired.push_back(*name);
+                _timers.erase(*name);
+            }
+            due.clear();
+        }
+        _current_tick = std::max(_current_tick, target_tick);
+        return expired;
+    }
+
+    std::optional<TimerWheel::Clock::time_point> TimerWheel::getNextAdvanceTime() const
+    {
+        if (_timers.empty())
+        {
+            return {};
+        }
+        return _start + _resolution * getNextEventTick();
+    }
+
+    size_t TimerWheel::size() const
+    {
+        return _timers.size();
+    }
+
+    void TimerWheel::insert(Timers::iterator timer)
+    {
+        // the greatest tick the top level can hold, later timers expire early
+        const uint64_t max_delta = (uint64_t(1) << (slot_bits * level_count)) - 1;
+        auto& expiry_tick = timer->second._expiry_tick;
+        expiry_tick = std::min(expiry_tick, _current_tick + max_delta);
+
+        const auto delta = expiry_tick - _current_tick;
+        size_t level = 0;
+        while (level + 1 < level_count && delta >= (uint64_t(1) << (slot_bits * (level + 1))))
+        {
+            ++level;
+        }
+        timer->second._level = level;
+        timer->second._slot = (expiry_tick >> (slot_bits * level)) & slot_mask;
+        _slots[level][timer->second._slot].insert(&timer->first);
+    }
+
+    void TimerWheel::cascade(size_t level, size_t slot)
+    {
+        Slot cascaded;
+        std::swap(cascaded, _slots[level][slot]);
+        for (const auto* name : cascaded)
+        {
+            insert(_timers.find(*name));
+        }
+    }
+
+    uint64_t TimerWheel::getNextEventTick() const
+    {
+        // the timers of a level are touched only at the ticks a slot of the level starts with,
+        // expired on the lowest level and cascaded on the higher levels, so empty slots are skipped
+        auto next_tick = std::numeric_limits<uint64_t>::max();
+        for (size_t level = 0; level < level_count; ++level)
+        {
+            const auto shift = slot_bits * level;
+            for (uint64_t offset = 1; offset <= slot_count; ++offset)
+            {
+                const auto slot_begin = (_current_tick >> shift) + offset;
+                if (!_slots[level][slot_begin & slot_mask].empty())
+                {
+                    next_tick = std::min(next_tick, slot_begin << shift);
+                    break;
+                }
+            }
+        }
+        return next_tick;
+    }
+
+    uint64_t TimerWheel::toTick(Clock::time_point time) const
+    {
+        if (time <= _start)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>((time - _start) / _resolution);
+    }
+}
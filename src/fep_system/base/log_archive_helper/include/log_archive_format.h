@@ -0,0 +1,150 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/**
+ * The binary layout of the log archive, all values in the byte order of the writing host.
+ *
+ * A segment file "segment_<sequence>.bin" starts with a @ref SegmentHeader followed by entries,
+ * each an @ref EntryHeader followed by its text and padded to 8 bytes.
+ * The names are defined by entries within the segment before their first use, so a segment is self-contained.
+ * The writer updates the header after each record, the reader only reads up to SegmentHeader::_data_end.
+ *
+ * When a segment is closed, the index file "segment_<sequence>.idx" is written, it is an @ref IndexHeader
+ * followed by the participant names, the logger names (each a uint32_t length and the characters)
+ * and the @ref IndexBlock of every @ref records_per_index_block records.
+ */
+namespace fep3
+{
+namespace log_archive
+{
+constexpr char segment_magic[8] = { 'F', 'E', 'P', '3', 'L', 'S', 'E', 'G' };
+constexpr char index_magic[8] = { 'F', 'E', 'P', '3', 'L', 'I', 'D', 'X' };
+constexpr uint32_t format_version = 1;
+constexpr uint32_t records_per_index_block = 256;
+constexpr const char* segment_file_prefix = "segment_";
+constexpr const char* segment_file_extension = ".bin";
+constexpr const char* index_file_extension = ".idx";
+
+struct SegmentHeader
+{
+    char _magic[8];
+    uint32_t _version;
+    uint32_t _header_size;
+    /// size of the file while it is written
+    uint64_t _capacity;
+    /// end of the last complete entry, written after the entry
+    uint64_t _data_end;
+    uint64_t _record_count;
+    int64_t _min_time;
+    int64_t _max_time;
+    /// bit n is set if a record of severity n is contained
+    uint32_t _severity_mask;
+    uint32_t _reserved;
+};
+static_assert(sizeof(SegmentHeader) == 64, "the segment header is part of the file format");
+
+enum class EntryType : uint8_t
+{
+    participant_name = 1,
+    logger_name = 2,
+    record = 3
+};
+
+struct EntryHeader
+{
+    /// size of the entry including the header, the text and the padding
+    uint32_t _size;
+    EntryType _type;
+    uint8_t _severity;
+    uint16_t _reserved;
+    int64_t _timestamp;
+    /// id of the participant name of a record, or the id defined by a name entry
+    uint32_t _participant_id;
+    uint32_t _logger_id;
+    /// size of the message of a record or the defined name
+    uint32_t _text_size;
+    uint32_t _reserved_2;
+};
+static_assert(sizeof(EntryHeader) == 32, "the entry header is part of the file format");
+
+struct IndexHeader
+{
+    char _magic[8];
+    uint32_t _version;
+    uint32_t _block_count;
+    /// has to match SegmentHeader::_record_count, the index is outdated otherwise
+    uint64_t _record_count;
+    uint32_t _participant_name_count;
+    uint32_t _logger_name_count;
+};
+static_assert(sizeof(IndexHeader) == 32, "the index header is part of the file format");
+
+struct IndexBlock
+{
+    uint64_t _begin;
+    uint64_t _end;
+    int64_t _min_time;
+    int64_t _max_time;
+    uint32_t _severity_mask;
+    uint32_t _reserved;
+    /// bit (id % 64) is set if a record of the participant with that id is contained
+    uint64_t _participant_mask;
+};
+static_assert(sizeof(IndexBlock) == 48, "the index block is part of the file format");
+
+/// id of the empty name, which is not defined by an entry
+constexpr uint32_t empty_name_id = 0;
+
+inline uint64_t alignEntrySize(uint64_t size)
+{
+    return (size + 7) & ~uint64_t(7);
+}
+
+inline uint64_t getParticipantBit(uint32_t participant_id)
+{
+    return uint64_t(1) << (participant_id % 64);
+}
+
+inline uint32_t getSeverityBit(uint32_t severity)
+{
+    return severity < 32 ? uint32_t(1) << severity : 0;
+}
+
+/// reads a value from a possibly unaligned position
+template<typename T>
+T readValue(const char* position)
+{
+    T value;
+    std::memcpy(&value, position, sizeof(T));
+    return value;
+}
+
+std::string getSegmentFileName(uint64_t sequence);
+std::string getIndexFileName(uint64_t sequence);
+/// @return the sequence of a segment file name, 0 if it is no segment file name
+uint64_t parseSegmentSequence(const std::string& file_name);
+
+} // namespace log_archive
+} // namespace fep3
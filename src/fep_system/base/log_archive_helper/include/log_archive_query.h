@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "fep_system/log_archive_types.h"
+
+#include <functional>
+#include <string>
+
+namespace fep3
+{
+/**
+ * @brief Passes the records of the log archive in @p directory selected by @p query to @p callback,
+ * in the order they were appended. The segments are read via their summary and index first,
+ * only the parts possibly containing selected records are scanned.
+ *
+ * @param[in] directory the directory of the segment files
+ * @param[in] query selects the records
+ * @param[in] callback called for every selected record, returns false to stop the query
+ * @return the number of records passed to the callback
+ * @throw std::runtime_error if a segment file cannot be read
+ */
+uint64_t queryLogArchive(const std::string& directory,
+    const LogArchiveQuery& query,
+    const std::function<bool(const LogArchiveEntry&)>& callback);
+
+} // namespace fep3
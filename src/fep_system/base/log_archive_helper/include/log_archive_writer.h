@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "log_archive_format.h"
+#include "mapped_file.h"
+#include "fep_system/log_archive_types.h"
+#include "fep_system/log_record.h"
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief Appends log records to the memory mapped segment files of a log archive, see @ref log_archive.
+ * Not thread safe.
+ */
+class LogArchiveWriter
+{
+public:
+    /// the smallest segment size, smaller configured sizes are raised to it
+    static constexpr uint64_t min_segment_size = 4096;
+
+    /// starts a new segment after the existing segments of the directory
+    /// @throw std::runtime_error if the directory or the segment file cannot be created
+    explicit LogArchiveWriter(const LogArchiveConfig& config);
+    /// closes the current segment
+    ~LogArchiveWriter();
+
+    LogArchiveWriter(const LogArchiveWriter&) = delete;
+    LogArchiveWriter& operator=(const LogArchiveWriter&) = delete;
+
+    /// appends the record, a full segment is closed and a new one is started
+    /// @return false if the names of the record do not fit into an empty segment
+    /// @throw std::runtime_error if a new segment cannot be created
+    bool append(const LogRecord& record);
+    void flush();
+    uint64_t getSegmentSequence() const;
+
+private:
+    /// the names of a segment by their ids
+    struct NameTable
+    {
+        /// @return the id of the name, 0 if it is not defined within the segment yet
+        uint32_t find(const std::string& name) const;
+        uint32_t add(const std::string& name);
+        void clear();
+
+        std::unordered_map<std::string, uint32_t> _ids;
+        std::vector<std::string> _names{ std::string() };
+    };
+
+    void openSegment();
+    void closeSegment();
+    void writeIndex() const;
+    void removeOldSegments();
+    uint32_t writeName(NameTable& names, log_archive::EntryType type, const std::string& name);
+    void writeEntry(const log_archive::EntryHeader& entry_header, const char* text);
+    void finishBlock();
+
+    const std::string _directory;
+    const uint64_t _segment_size;
+    const uint32_t _max_segments;
+    /// sequences of the segment files in the directory, the oldest first
+    std::deque<uint64_t> _segments;
+    MappedFile _file;
+    log_archive::SegmentHeader* _header = nullptr;
+    uint64_t _data_end = 0;
+    NameTable _participant_names;
+    NameTable _logger_names;
+    std::vector<log_archive::IndexBlock> _blocks;
+    log_archive::IndexBlock _block{};
+    uint32_t _block_record_count = 0;
+};
+
+} // namespace fep3
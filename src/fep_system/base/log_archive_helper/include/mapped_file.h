@@ -0,0 +1,82 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief A file mapped into the memory, either created writable with a fixed size or opened read only.
+ * Failures throw std::runtime_error.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    /// unmaps the file without truncating it
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// creates or overwrites the file with @p size bytes of zeros and maps it writable
+    void create(const std::string& file_path, uint64_t size);
+    /// maps the whole existing file read only, an empty file is not mapped
+    void openReadOnly(const std::string& file_path);
+    /// writes the changed pages to the disk
+    void flush();
+    /// unmaps the file and truncates it to @p size bytes if it is smaller than the mapped size
+    void close(uint64_t size = UINT64_MAX);
+
+    bool isOpen() const;
+    char* getData();
+    const char* getData() const;
+    uint64_t getSize() const;
+
+private:
+    void unmapView();
+    /// unmaps and closes the file
+    void unmap();
+    /// unmaps the file and throws the error of the failed system call
+    [[noreturn]] void unmapAndThrow(const std::string& what, const std::string& file_path);
+
+    char* _data = nullptr;
+    uint64_t _size = 0;
+    bool _writable = false;
+#ifdef WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#else
+    int _file = -1;
+#endif
+};
+
+/// @return the names of the regular files within the directory, empty if the directory does not exist
+std::vector<std::string> listFileNames(const std::string& directory);
+/// creates the directory and its parents if they do not exist
+/// @throw std::runtime_error if a directory cannot be created
+void createDirectories(const std::string& directory);
+/// joins the directory and the file name
+std::string joinPath(const std::string& directory, const std::string& file_name);
+
+} // namespace fep3
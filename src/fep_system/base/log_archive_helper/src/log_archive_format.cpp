@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_archive_format.h"
+
+namespace fep3
+{
+namespace log_archive
+{
+namespace
+{
+constexpr size_t sequence_digits = 8;
+
+std::string getFileName(uint64_t sequence, const char* extension)
+{
+    auto digits = std::to_string(sequence);
+    if (digits.size() < sequence_digits)
+    {
+        digits.insert(0, sequence_digits - digits.size(), '0');
+    }
+    return segment_file_prefix + digits + extension;
+}
+} // namespace
+
+std::string getSegmentFileName(uint64_t sequence)
+{
+    return getFileName(sequence, segment_file_extension);
+}
+
+std::string getIndexFileName(uint64_t sequence)
+{
+    return getFileName(sequence, index_file_extension);
+}
+
+uint64_t parseSegmentSequence(const std::string& file_name)
+{
+    const std::string prefix = segment_file_prefix, extension = segment_file_extension;
+    if (file_name.size() <= prefix.size() + extension.size()
+        || file_name.compare(0, prefix.size(), prefix) != 0
+        || file_name.compare(file_name.size() - extension.size(), extension.size(), extension) != 0)
+    {
+        return 0;
+    }
+    uint64_t sequence = 0;
+    for (size_t position = prefix.size(); position < file_name.size() - extension.size(); ++position)
+    {
+        const auto digit = file_name[position];
+        if (digit < '0' || digit > '9')
+        {
+            return 0;
+        }
+        sequence = sequence * 10 + static_cast<uint64_t>(digit - '0');
+    }
+    return sequence;
+}
+
+} // namespace log_archive
+} // namespace fep3
@@ -0,0 +1,342 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_archive_query.h"
+#include "log_archive_format.h"
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace fep3
+{
+using namespace log_archive;
+
+namespace
+{
+/// more names within one segment are not plausible
+constexpr uint32_t max_name_id = 1u << 24;
+
+/**
+ * Reads the selected records of the segments, one segment after the other.
+ */
+class SegmentQuery
+{
+public:
+    SegmentQuery(const LogArchiveQuery& query, const std::function<bool(const LogArchiveEntry&)>& callback)
+        : _query(query)
+        , _callback(callback)
+    {
+        for (auto severity = static_cast<uint32_t>(LoggerSeverity::fatal);
+            severity <= static_cast<uint32_t>(query._severity);
+            ++severity)
+        {
+            _severity_mask |= getSeverityBit(severity);
+        }
+    }
+
+    /// @return false if the callback stopped the query
+    bool readSegment(const std::string& segment_file_path, const std::string& index_file_path)
+    {
+        MappedFile file;
+        file.openReadOnly(segment_file_path);
+        if (file.getSize() < sizeof(SegmentHeader))
+        {
+            return true;
+        }
+        const auto data = file.getData();
+        // the end is read first, the entries before it are complete
+        const auto data_end = std::min(readValue<uint64_t>(data + offsetof(SegmentHeader, _data_end)), file.getSize());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto header = readValue<SegmentHeader>(data);
+        if (std::memcmp(header._magic, segment_magic, sizeof(segment_magic)) != 0
+            || header._version != format_version
+            || header._record_count == 0
+            || !isTimeRangeSelected(header._min_time, header._max_time)
+            || (header._severity_mask & _severity_mask) == 0)
+        {
+            return true;
+        }
+
+        _participant_names.assign(1, std::string());
+        _logger_names.assign(1, std::string());
+        _participant_selection.clear();
+        std::vector<IndexBlock> blocks;
+        if (!readIndex(index_file_path, header._record_count, blocks))
+        {
+            // not closed yet or the index is lost
+            return scan(data, header._header_size, data_end);
+        }
+        const auto participant_mask = getParticipantMask();
+        if (participant_mask == 0)
+        {
+            return true;
+        }
+        for (const auto& block : blocks)
+        {
+            if (block._begin < header._header_size || block._begin > block._end || block._end > data_end)
+            {
+                // the index does not fit to the segment
+                return scan(data, header._header_size, data_end);
+            }
+            if (isTimeRangeSelected(block._min_time, block._max_time)
+                && (block._severity_mask & _severity_mask) != 0
+                && (block._participant_mask & participant_mask) != 0)
+            {
+                if (!scan(data, block._begin, block._end))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    uint64_t getPassedCount() const
+    {
+        return _passed_count;
+    }
+
+private:
+    bool isTimeRangeSelected(int64_t min_time, int64_t max_time) const
+    {
+        return min_time <= max_time && min_time < _query._end.count() && max_time >= _query._begin.count();
+    }
+
+    bool readIndex(const std::string& index_file_path, uint64_t record_count, std::vector<IndexBlock>& blocks)
+    {
+        std::ifstream file(index_file_path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        const std::string content{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        if (content.size() < sizeof(IndexHeader))
+        {
+            return false;
+        }
+        const auto index_header = readValue<IndexHeader>(content.data());
+        if (std::memcmp(index_header._magic, index_magic, sizeof(index_magic)) != 0
+            || index_header._version != format_version
+            || index_header._record_count != record_count
+            || index_header._participant_name_count >= max_name_id
+            || index_header._logger_name_count >= max_name_id)
+        {
+            return false;
+        }
+        size_t position = sizeof(IndexHeader);
+        const auto read_names = [&](uint32_t count, std::vector<std::string>& names) {
+            for (uint32_t id = 1; id <= count; ++id)
+            {
+                if (content.size() - position < sizeof(uint32_t))
+                {
+                    return false;
+                }
+                const auto size = readValue<uint32_t>(content.data() + position);
+                position += sizeof(uint32_t);
+                if (content.size() - position < size)
+                {
+                    return false;
+                }
+                names.emplace_back(content.data() + position, size);
+                position += size;
+            }
+            return true;
+        };
+        if (!read_names(index_header._participant_name_count, _participant_names)
+            || !read_names(index_header._logger_name_count, _logger_names)
+            || (content.size() - position) / sizeof(IndexBlock) < index_header._block_count)
+        {
+            return false;
+        }
+        blocks.resize(index_header._block_count);
+        std::memcpy(blocks.data(), content.data() + position, blocks.size() * sizeof(IndexBlock));
+        return true;
+    }
+
+    uint64_t getParticipantMask()
+    {
+        if (_query._participant_names.empty())
+        {
+            return UINT64_MAX;
+        }
+        uint64_t participant_mask = 0;
+        for (uint32_t id = 0; id < _participant_names.size(); ++id)
+        {
+            if (isParticipantSelected(id))
+            {
+                participant_mask |= getParticipantBit(id);
+            }
+        }
+        return participant_mask;
+    }
+
+    bool isParticipantSelected(uint32_t id)
+    {
+        if (_query._participant_names.empty())
+        {
+            return true;
+        }
+        if (id >= _participant_names.size())
+        {
+            // not defined, i.e. the empty name
+            return _query._participant_names.count(_participant_names[0]) != 0;
+        }
+        if (id >= _participant_selection.size())
+        {
+            _participant_selection.resize(_participant_names.size(), unknown);
+        }
+        if (_participant_selection[id] == unknown)
+        {
+            _participant_selection[id] = _query._participant_names.count(_participant_names[id]) != 0 ? selected : not_selected;
+        }
+        return _participant_selection[id] == selected;
+    }
+
+    void setName(std::vector<std::string>& names, uint32_t id, const char* text, uint32_t size)
+    {
+        if (id == empty_name_id || id >= max_name_id)
+        {
+            return;
+        }
+        if (id >= names.size())
+        {
+            names.resize(static_cast<size_t>(id) + 1);
+        }
+        names[id].assign(text, size);
+        if (&names == &_participant_names && id < _participant_selection.size())
+        {
+            _participant_selection[id] = unknown;
+        }
+    }
+
+    const std::string& getName(const std::vector<std::string>& names, uint32_t id) const
+    {
+        return id < names.size() ? names[id] : names[0];
+    }
+
+    /// @return false if the callback stopped the query
+    bool scan(const char* data, uint64_t position, uint64_t end)
+    {
+        while (end - position >= sizeof(EntryHeader))
+        {
+            const auto entry_header = readValue<EntryHeader>(data + position);
+            if (entry_header._size < sizeof(EntryHeader)
+                || entry_header._size > end - position
+                || entry_header._text_size > entry_header._size - sizeof(EntryHeader))
+            {
+                // a corrupted entry ends the segment
+                return true;
+            }
+            const auto text = data + position + sizeof(EntryHeader);
+            switch (entry_header._type)
+            {
+            case EntryType::participant_name:
+                setName(_participant_names, entry_header._participant_id, text, entry_header._text_size);
+                break;
+            case EntryType::logger_name:
+                setName(_logger_names, entry_header._participant_id, text, entry_header._text_size);
+                break;
+            case EntryType::record:
+                if (entry_header._timestamp >= _query._begin.count()
+                    && entry_header._timestamp < _query._end.count()
+                    && (getSeverityBit(entry_header._severity) & _severity_mask) != 0
+                    && isParticipantSelected(entry_header._participant_id))
+                {
+                    _entry._timestamp = std::chrono::nanoseconds(entry_header._timestamp);
+                    _entry._severity = static_cast<LoggerSeverity>(entry_header._severity);
+                    _entry._participant_name = getName(_participant_names, entry_header._participant_id);
+                    _entry._logger_name = getName(_logger_names, entry_header._logger_id);
+                    _entry._message.assign(text, entry_header._text_size);
+                    ++_passed_count;
+                    if (!_callback(_entry))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+            position += entry_header._size;
+        }
+        return true;
+    }
+
+    enum Selection : int8_t
+    {
+        unknown,
+        selected,
+        not_selected
+    };
+
+    const LogArchiveQuery& _query;
+    const std::function<bool(const LogArchiveEntry&)>& _callback;
+    uint32_t _severity_mask = 0;
+    uint64_t _passed_count = 0;
+    std::vector<std::string> _participant_names;
+    std::vector<std::string> _logger_names;
+    /// the selection of the participant ids of the current segment
+    std::vector<Selection> _participant_selection;
+    /// reused for every passed record
+    LogArchiveEntry _entry;
+};
+} // namespace
+
+uint64_t queryLogArchive(const std::string& directory,
+    const LogArchiveQuery& query,
+    const std::function<bool(const LogArchiveEntry&)>& callback)
+{
+    std::vector<uint64_t> sequences;
+    for (const auto& file_name : listFileNames(directory))
+    {
+        if (const auto sequence = parseSegmentSequence(file_name))
+        {
+            sequences.push_back(sequence);
+        }
+    }
+    std::sort(sequences.begin(), sequences.end());
+
+    SegmentQuery segment_query(query, callback);
+    for (const auto sequence : sequences)
+    {
+        const auto segment_file_path = joinPath(directory, getSegmentFileName(sequence));
+        try
+        {
+            if (!segment_query.readSegment(segment_file_path, joinPath(directory, getIndexFileName(sequence))))
+            {
+                break;
+            }
+        }
+        catch (const std::runtime_error&)
+        {
+            const auto file_names = listFileNames(directory);
+            if (std::find(file_names.begin(), file_names.end(), getSegmentFileName(sequence)) != file_names.end())
+            {
+                throw;
+            }
+            // removed by the writer in the meantime
+        }
+    }
+    return segment_query.getPassedCount();
+}
+
+} // namespace fep3
@@ -0,0 +1,300 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_archive_writer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace fep3
+{
+using namespace log_archive;
+
+namespace
+{
+uint64_t getEntrySize(uint64_t text_size)
+{
+    return alignEntrySize(sizeof(EntryHeader) + text_size);
+}
+
+uint64_t getNameEntrySize(uint32_t id, const std::string& name)
+{
+    return id == empty_name_id && !name.empty() ? getEntrySize(name.size()) : 0;
+}
+
+void writeNames(std::ofstream& file, const std::vector<std::string>& names)
+{
+    // the empty name with id 0 is not written
+    for (size_t id = 1; id < names.size(); ++id)
+    {
+        const auto size = static_cast<uint32_t>(names[id].size());
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(names[id].data(), size);
+    }
+}
+} // namespace
+
+uint32_t LogArchiveWriter::NameTable::find(const std::string& name) const
+{
+    const auto found = _ids.find(name);
+    return found == _ids.end() ? empty_name_id : found->second;
+}
+
+uint32_t LogArchiveWriter::NameTable::add(const std::string& name)
+{
+    const auto id = static_cast<uint32_t>(_names.size());
+    _ids.emplace(name, id);
+    _names.push_back(name);
+    return id;
+}
+
+void LogArchiveWriter::NameTable::clear()
+{
+    _ids.clear();
+    _names.resize(1);
+}
+
+LogArchiveWriter::LogArchiveWriter(const LogArchiveConfig& config)
+    : _directory(config._directory.empty() ? std::string(".") : config._directory)
+    // the entries are aligned to 8 bytes
+    , _segment_size(std::max(config._segment_size, min_segment_size) & ~uint64_t(7))
+    , _max_segments(config._max_segments)
+{
+    createDirectories(_directory);
+    for (const auto& file_name : listFileNames(_directory))
+    {
+        if (const auto sequence = parseSegmentSequence(file_name))
+        {
+            _segments.push_back(sequence);
+        }
+    }
+    std::sort(_segments.begin(), _segments.end());
+    openSegment();
+}
+
+LogArchiveWriter::~LogArchiveWriter()
+{
+    try
+    {
+        closeSegment();
+    }
+    catch (...)
+    {
+    }
+}
+
+bool LogArchiveWriter::append(const LogRecord& record)
+{
+    const auto& participant_name = record.getParticipantName();
+    const auto& logger_name = record.getLoggerName();
+    const auto names_size = [&]() {
+        return getNameEntrySize(_participant_names.find(participant_name), participant_name)
+            + getNameEntrySize(_logger_names.find(logger_name), logger_name);
+    };
+    uint64_t message_size = record._message.size();
+    if (!_file.isOpen() || _data_end + names_size() + getEntrySize(message_size) > _segment_size)
+    {
+        closeSegment();
+        openSegment();
+    }
+    const auto available = _segment_size - _data_end;
+    if (names_size() + sizeof(EntryHeader) > available)
+    {
+        return false;
+    }
+    // a message exceeding an empty segment is truncated
+    message_size = std::min({ message_size,
+        available - names_size() - sizeof(EntryHeader),
+        uint64_t(UINT32_MAX) - sizeof(EntryHeader) - 7 });
+
+    if (_block_record_count == 0)
+    {
+        _block = {};
+        _block._begin = _data_end;
+        _block._min_time = INT64_MAX;
+        _block._max_time = INT64_MIN;
+    }
+    EntryHeader entry_header{};
+    entry_header._type = EntryType::record;
+    entry_header._severity = static_cast<uint8_t>(record._severity);
+    entry_header._timestamp = record._timestamp.count();
+    entry_header._participant_id = _participant_names.find(participant_name);
+    if (entry_header._participant_id == empty_name_id && !participant_name.empty())
+    {
+        entry_header._participant_id = writeName(_participant_names, EntryType::participant_name, participant_name);
+    }
+    entry_header._logger_id = _logger_names.find(logger_name);
+    if (entry_header._logger_id == empty_name_id && !logger_name.empty())
+    {
+        entry_header._logger_id = writeName(_logger_names, EntryType::logger_name, logger_name);
+    }
+    entry_header._text_size = static_cast<uint32_t>(message_size);
+    writeEntry(entry_header, record._message.data());
+
+    const auto severity_bit = getSeverityBit(entry_header._severity);
+    _block._end = _data_end;
+    _block._min_time = std::min(_block._min_time, entry_header._timestamp);
+    _block._max_time = std::max(_block._max_time, entry_header._timestamp);
+    _block._severity_mask |= severity_bit;
+    _block._participant_mask |= getParticipantBit(entry_header._participant_id);
+    if (++_block_record_count == records_per_index_block)
+    {
+        finishBlock();
+    }
+
+    _header->_record_count++;
+    _header->_min_time = std::min(_header->_min_time, entry_header._timestamp);
+    _header->_max_time = std::max(_header->_max_time, entry_header._timestamp);
+    _header->_severity_mask |= severity_bit;
+    // a reader of the mapped file finds the entry complete once the end is updated
+    std::atomic_thread_fence(std::memory_order_release);
+    _header->_data_end = _data_end;
+    return true;
+}
+
+void LogArchiveWriter::flush()
+{
+    _file.flush();
+}
+
+uint64_t LogArchiveWriter::getSegmentSequence() const
+{
+    return _segments.empty() ? 0 : _segments.back();
+}
+
+void LogArchiveWriter::openSegment()
+{
+    const auto sequence = getSegmentSequence() + 1;
+    _file.create(joinPath(_directory, getSegmentFileName(sequence)), _segment_size);
+    _segments.push_back(sequence);
+
+    _header = reinterpret_cast<SegmentHeader*>(_file.getData());
+    std::memcpy(_header->_magic, segment_magic, sizeof(segment_magic));
+    _header->_version = format_version;
+    _header->_header_size = sizeof(SegmentHeader);
+    _header->_capacity = _segment_size;
+    _header->_record_count = 0;
+    _header->_min_time = INT64_MAX;
+    _header->_max_time = INT64_MIN;
+    _header->_severity_mask = 0;
+    _data_end = sizeof(SegmentHeader);
+    _header->_data_end = _data_end;
+    _participant_names.clear();
+    _logger_names.clear();
+    _blocks.clear();
+    _block_record_count = 0;
+
+    removeOldSegments();
+}
+
+void LogArchiveWriter::closeSegment()
+{
+    if (!_file.isOpen())
+    {
+        return;
+    }
+    finishBlock();
+    try
+    {
+        writeIndex();
+    }
+    catch (...)
+    {
+        // the segment is still readable without its index
+    }
+    _header = nullptr;
+    _file.close(_data_end);
+}
+
+void LogArchiveWriter::writeIndex() const
+{
+    const auto sequence = getSegmentSequence();
+    const auto index_file_path = joinPath(_directory, getIndexFileName(sequence));
+    const auto temporary_file_path = index_file_path + ".tmp";
+    {
+        std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        IndexHeader index_header{};
+        std::memcpy(index_header._magic, index_magic, sizeof(index_magic));
+        index_header._version = format_version;
+        index_header._block_count = static_cast<uint32_t>(_blocks.size());
+        index_header._record_count = _header->_record_count;
+        index_header._participant_name_count = static_cast<uint32_t>(_participant_names._names.size() - 1);
+        index_header._logger_name_count = static_cast<uint32_t>(_logger_names._names.size() - 1);
+        file.write(reinterpret_cast<const char*>(&index_header), sizeof(index_header));
+        writeNames(file, _participant_names._names);
+        writeNames(file, _logger_names._names);
+        file.write(reinterpret_cast<const char*>(_blocks.data()), _blocks.size() * sizeof(IndexBlock));
+        if (!file)
+        {
+            throw std::runtime_error("unable to write the index file '" + temporary_file_path + "'");
+        }
+    }
+    // the index is published complete
+    std::remove(index_file_path.c_str());
+    if (std::rename(temporary_file_path.c_str(), index_file_path.c_str()) != 0)
+    {
+        std::remove(temporary_file_path.c_str());
+        throw std::runtime_error("unable to write the index file '" + index_file_path + "'");
+    }
+}
+
+void LogArchiveWriter::removeOldSegments()
+{
+    while (_max_segments != 0 && _segments.size() > _max_segments)
+    {
+        std::remove(joinPath(_directory, getIndexFileName(_segments.front())).c_str());
+        std::remove(joinPath(_directory, getSegmentFileName(_segments.front())).c_str());
+        _segments.pop_front();
+    }
+}
+
+uint32_t LogArchiveWriter::writeName(NameTable& names, EntryType type, const std::string& name)
+{
+    EntryHeader entry_header{};
+    entry_header._type = type;
+    entry_header._participant_id = names.add(name);
+    entry_header._text_size = static_cast<uint32_t>(name.size());
+    writeEntry(entry_header, name.data());
+    return entry_header._participant_id;
+}
+
+void LogArchiveWriter::writeEntry(const EntryHeader& entry_header, const char* text)
+{
+    const auto size = getEntrySize(entry_header._text_size);
+    auto position = _file.getData() + _data_end;
+    std::memcpy(position, &entry_header, sizeof(entry_header));
+    reinterpret_cast<EntryHeader*>(position)->_size = static_cast<uint32_t>(size);
+    std::memcpy(position + sizeof(entry_header), text, entry_header._text_size);
+    // the padding is zero already, the file is created with zeros
+    _data_end += size;
+}
+
+void LogArchiveWriter::finishBlock()
+{
+    if (_block_record_count != 0)
+    {
+        _blocks.push_back(_block);
+        _block_record_count = 0;
+    }
+}
+
+} // namespace fep3
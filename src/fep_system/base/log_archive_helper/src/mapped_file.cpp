@@ -0,0 +1,311 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "mapped_file.h"
+
+#include <a_util/filesystem.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fep3
+{
+namespace
+{
+/// @return the description of the error of the last failed system call
+std::string getLastError()
+{
+#ifdef WIN32
+    return std::to_string(::GetLastError());
+#else
+    return std::strerror(errno);
+#endif
+}
+
+[[noreturn]] void throwError(const std::string& what, const std::string& file_path, const std::string& error)
+{
+    throw std::runtime_error(what + " '" + file_path + "': " + error);
+}
+
+#ifdef WIN32
+bool setFileSize(HANDLE file, uint64_t size)
+{
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    return ::SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && ::SetEndOfFile(file);
+}
+#endif
+} // namespace
+
+MappedFile::~MappedFile()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+    }
+}
+
+void MappedFile::create(const std::string& file_path, uint64_t size)
+{
+    close();
+#ifdef WIN32
+    const auto file = ::CreateFileA(file_path.c_str(), GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throwError("unable to create the file", file_path, getLastError());
+    }
+    _file = file;
+    if (!setFileSize(file, size))
+    {
+        unmapAndThrow("unable to resize the file", file_path);
+    }
+    _mapping = ::CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+    if (_mapping)
+    {
+        _data = static_cast<char*>(::MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(size)));
+    }
+#else
+    _file = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (_file < 0)
+    {
+        throwError("unable to create the file", file_path, getLastError());
+    }
+    if (::ftruncate(_file, static_cast<off_t>(size)) != 0)
+    {
+        unmapAndThrow("unable to resize the file", file_path);
+    }
+    void* data = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+    _data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+#endif
+    if (!_data)
+    {
+        unmapAndThrow("unable to map the file", file_path);
+    }
+    _size = size;
+    _writable = true;
+}
+
+void MappedFile::openReadOnly(const std::string& file_path)
+{
+    close();
+#ifdef WIN32
+    const auto file = ::CreateFileA(file_path.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throwError("unable to open the file", file_path, getLastError());
+    }
+    _file = file;
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size))
+    {
+        unmapAndThrow("unable to get the size of the file", file_path);
+    }
+    if (size.QuadPart == 0)
+    {
+        return;
+    }
+    _mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping)
+    {
+        _data = static_cast<char*>(::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    }
+    const auto mapped_size = static_cast<uint64_t>(size.QuadPart);
+#else
+    _file = ::open(file_path.c_str(), O_RDONLY);
+    if (_file < 0)
+    {
+        throwError("unable to open the file", file_path, getLastError());
+    }
+    struct stat status;
+    if (::fstat(_file, &status) != 0)
+    {
+        unmapAndThrow("unable to get the size of the file", file_path);
+    }
+    if (status.st_size == 0)
+    {
+        return;
+    }
+    void* data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, _file, 0);
+    _data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+    const auto mapped_size = static_cast<uint64_t>(status.st_size);
+#endif
+    if (!_data)
+    {
+        unmapAndThrow("unable to map the file", file_path);
+    }
+    _size = mapped_size;
+}
+
+void MappedFile::flush()
+{
+    if (_data && _writable)
+    {
+#ifdef WIN32
+        ::FlushViewOfFile(_data, 0);
+        ::FlushFileBuffers(_file);
+#else
+        ::msync(_data, static_cast<size_t>(_size), MS_SYNC);
+#endif
+    }
+}
+
+void MappedFile::close(uint64_t size)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    const bool truncate = _writable && size < _size;
+    // the file cannot be truncated while it is mapped
+    unmapView();
+#ifdef WIN32
+    const bool truncated = !truncate || setFileSize(_file, size);
+#else
+    const bool truncated = !truncate || ::ftruncate(_file, static_cast<off_t>(size)) == 0;
+#endif
+    const auto error = truncated ? std::string() : getLastError();
+    unmap();
+    if (!truncated)
+    {
+        throw std::runtime_error("unable to truncate a mapped file: " + error);
+    }
+}
+
+bool MappedFile::isOpen() const
+{
+#ifdef WIN32
+    return _file != nullptr;
+#else
+    return _file >= 0;
+#endif
+}
+
+char* MappedFile::getData()
+{
+    return _data;
+}
+
+const char* MappedFile::getData() const
+{
+    return _data;
+}
+
+uint64_t MappedFile::getSize() const
+{
+    return _size;
+}
+
+void MappedFile::unmapAndThrow(const std::string& what, const std::string& file_path)
+{
+    // captured first, closing the file overwrites the error of the failed call
+    const auto error = getLastError();
+    unmap();
+    throwError(what, file_path, error);
+}
+
+void MappedFile::unmapView()
+{
+    if (_data)
+    {
+#ifdef WIN32
+        ::UnmapViewOfFile(_data);
+#else
+        ::munmap(_data, static_cast<size_t>(_size));
+#endif
+        _data = nullptr;
+    }
+#ifdef WIN32
+    if (_mapping)
+    {
+        ::CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+#endif
+}
+
+void MappedFile::unmap()
+{
+    unmapView();
+#ifdef WIN32
+    if (_file)
+    {
+        ::CloseHandle(_file);
+        _file = nullptr;
+    }
+#else
+    if (_file >= 0)
+    {
+        ::close(_file);
+        _file = -1;
+    }
+#endif
+    _size = 0;
+    _writable = false;
+}
+
+std::vector<std::string> listFileNames(const std::string& directory)
+{
+    std::vector<std::string> file_names;
+    std::vector<a_util::filesystem::Path> entries;
+    if (a_util::filesystem::enumDirectory(directory, entries, a_util::filesystem::ED_FILES) != a_util::filesystem::OK)
+    {
+        return file_names;
+    }
+    file_names.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        file_names.push_back(entry.getLastElement().toString());
+    }
+    return file_names;
+}
+
+void createDirectories(const std::string& directory)
+{
+    // creates the missing parents as well
+    if (!a_util::filesystem::createDirectory(directory) && !a_util::filesystem::isDirectory(directory))
+    {
+        throw std::runtime_error("unable to create the directory '" + directory + "'");
+    }
+}
+
+std::string joinPath(const std::string& directory, const std::string& file_name)
+{
+    if (directory.empty())
+    {
+        return file_name;
+    }
+    return a_util::filesystem::Path(directory).append(file_name).toString();
+}
+
+} // namespace fep3
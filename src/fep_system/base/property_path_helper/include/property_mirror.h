@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "property_path.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief In-memory copy of the properties of several participants for local queries.
+ * The properties of all participants share one tree of interned path segments,
+ * the leaves hold the value per participant. Equal values and types are stored only once,
+ * so the memory grows with the number of unique strings rather than with the number of participants.
+ * Nodes left without values by removed or replaced participants are removed as well.
+ * All methods are thread safe.
+ */
+class PropertyMirror
+{
+public:
+    struct Property
+    {
+        /// path relative to the root node, i.e. "clock/main_clock"
+        std::string _path;
+        std::string _type;
+        std::string _value;
+    };
+
+    /// property values by relative path
+    using Values = std::map<std::string, std::string>;
+
+    PropertyMirror();
+    ~PropertyMirror();
+    PropertyMirror(const PropertyMirror&) = delete;
+    PropertyMirror& operator=(const PropertyMirror&) = delete;
+
+    /**
+     * @brief Replaces all mirrored properties of a participant.
+     * Properties with an invalid path are ignored.
+     *
+     * @param[in] participant_name the participant the properties belong to
+     * @param[in] properties all properties of the participant
+     */
+    void setParticipant(const std::string& participant_name, const std::vector<Property>& properties);
+
+    /**
+     * @brief Removes all mirrored properties of a participant.
+     */
+    void removeParticipant(const std::string& participant_name);
+
+    /**
+     * @brief Removes all mirrored properties.
+     */
+    void clear();
+
+    /// @return @c true if the properties of the participant are mirrored
+    bool containsParticipant(const std::string& participant_name) const;
+
+    /// @return the number of path segments in the tree, nodes without values and children are removed
+    size_t getNodeCount() const;
+
+    /**
+     * @brief Updates the value of an already mirrored property, i.e. after it was written.
+     * Nothing is done if the participant or the property is not mirrored.
+     *
+     * @return @c true if the property was updated
+     */
+    bool updateValue(const std::string& participant_name, const PropertyPath& property_path, const std::string& value);
+
+    /// @return the mirrored value, empty if the participant or the property is not mirrored
+    std::optional<std::string> getValue(const std::string& participant_name, const PropertyPath& property_path) const;
+
+    /**
+     * @brief Finds all participants whose property has the given value.
+     *
+     * @return the names of the participants, sorted
+     */
+    std::vector<std::string> findParticipants(const PropertyPath& property_path, const std::string& value) const;
+
+    /**
+     * @brief Gets the values of all properties matching a pattern over all participants.
+     * The pattern is a property path in which a segment consisting of an asterisk matches any single segment,
+     * i.e. the cycle times of all jobs are matched by "job_registry/jobs/" + "*" + "/cycle_sim_time".
+     *
+     * @param[in] path_pattern the pattern to match
+     * @return the values by relative path and participant name, empty if the pattern is invalid
+     */
+    std::map<std::string, Values> query(const std::string& path_pattern) const;
+
+private:
+    struct Node;
+    using ParticipantId = uint32_t;
+
+    const std::string* internString(const std::string& value);
+    void releaseString(const std::string* value);
+    /// removes the values of the participant and the nodes left empty
+    void removeParticipantValues(ParticipantId participant_id);
+    void pruneNode(Node* node);
+    std::optional<ParticipantId> findParticipantId(const std::string& participant_name) const;
+    Node* findNode(const PropertyPath& property_path) const;
+
+    mutable std::shared_mutex _sync;
+    std::unique_ptr<Node> _root;
+    /// without the root
+    size_t _node_count = 0;
+    /// interned values and types with the number of their usages
+    std::unordered_map<std::string, size_t> _strings;
+    std::vector<std::string> _participant_names;
+    std::unordered_map<std::string, ParticipantId> _participant_ids;
+    /// the leaves holding a value of the participant, by participant id
+    std::vector<std::vector<Node*>> _participant_leaves;
+    /// ids of removed participants, reused before new ones are assigned
+    std::vector<ParticipantId> _free_participant_ids;
+};
+
+} // namespace fep3
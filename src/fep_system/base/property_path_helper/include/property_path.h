@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief Path of a property node, parsed and validated once.
+ * A valid path consists of segments of the characters [a-zA-Z0-9_], separated by single '/'
+ * and optionally enclosed in '/'. The root node is the empty path.
+ * The segments of stored paths are interned with @ref interned, so copying and comparing them does not copy
+ * any names. Parsing only looks the segments up, segments never interned are owned by the path,
+ * so paths which are only read or matched do not grow the process wide segment pool.
+ */
+class PropertyPath
+{
+public:
+    /// creates the path of the root node
+    PropertyPath() = default;
+
+    /**
+     * @brief Parses a property path without interning its segments.
+     *
+     * @param[in] path the path to parse, i.e. "/clock/main_clock"
+     * @param[in] allow_dot_separator if true, '.' is accepted as separator like '/'
+     * @return the parsed path, empty if the path is invalid
+     */
+    static std::optional<PropertyPath> parse(std::string_view path, bool allow_dot_separator = false);
+
+    /**
+     * @brief Checks a property path for validity without creating any segments.
+     *
+     * @param[in] path the path to check
+     * @param[in] allow_dot_separator if true, '.' is accepted as separator like '/'
+     * @return @c true if the path is valid, @c false otherwise
+     */
+    static bool isValid(std::string_view path, bool allow_dot_separator = false);
+
+    /**
+     * @brief Looks a single segment up without creating it.
+     *
+     * @param[in] segment the name of the segment, i.e. "clock"
+     * @return the segment as returned by @ref segment, nullptr if it was never interned
+     */
+    static const std::string* findSegment(std::string_view segment);
+
+    /**
+     * @brief Interns the segments of the path, so they are shared by all paths containing them.
+     * The pool of interned segments only grows, so only paths which are kept should be interned.
+     *
+     * @return the path with interned segments, it equals this path
+     */
+    PropertyPath interned() const;
+
+    bool isRoot() const;
+    size_t size() const;
+    const std::string& segment(size_t index) const;
+
+    /// @return the last segment, empty for the root node
+    const std::string& name() const;
+    /// @return the path of the parent node, the root node for the root node
+    PropertyPath parent() const;
+    /// @return this path followed by @p relative_path
+    PropertyPath append(const PropertyPath& relative_path) const;
+
+    /// @return the absolute path, i.e. "/clock/main_clock", "/" for the root node
+    std::string toString() const;
+    /// @return the absolute path of the node with a concluding '/', i.e. "/clock/", "/" for the root node
+    std::string toNodeString() const;
+    /// @return the path without leading '/', i.e. "clock/main_clock", empty for the root node
+    std::string toRelativeString() const;
+
+    bool operator==(const PropertyPath& other) const;
+    bool operator!=(const PropertyPath& other) const;
+
+private:
+    std::vector<const std::string*> _segments;
+    /// the segments which were not interned when parsing, shared by the copies of the path
+    std::vector<std::shared_ptr<const std::string>> _own_segments;
+};
+
+} // namespace fep3
@@ -0,0 +1,356 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "property_mirror.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+
+namespace fep3
+{
+struct PropertyMirror::Node
+{
+    struct Value
+    {
+        ParticipantId _participant;
+        const std::string* _type;
+        const std::string* _value;
+    };
+
+    std::vector<Value>::iterator findValue(ParticipantId participant)
+    {
+        return std::lower_bound(_values.begin(), _values.end(), participant,
+            [](const Value& value, ParticipantId id) { return value._participant < id; });
+    }
+
+    /// children by interned segment
+    std::map<const std::string*, std::unique_ptr<Node>> _children;
+    /// values sorted by participant
+    std::vector<Value> _values;
+    /// nullptr for the root
+    Node* _parent = nullptr;
+    const std::string* _segment = nullptr;
+};
+
+PropertyMirror::PropertyMirror() : _root(std::make_unique<Node>())
+{
+}
+
+PropertyMirror::~PropertyMirror() = default;
+
+void PropertyMirror::setParticipant(const std::string& participant_name, const std::vector<Property>& properties)
+{
+    std::unique_lock<std::shared_mutex> lock(_sync);
+    ParticipantId participant_id = 0;
+    if (const auto found = findParticipantId(participant_name))
+    {
+        participant_id = *found;
+        removeParticipantValues(participant_id);
+    }
+    else if (!_free_participant_ids.empty())
+    {
+        participant_id = _free_participant_ids.back();
+        _free_participant_ids.pop_back();
+        _participant_names[participant_id] = participant_name;
+        _participant_ids.emplace(participant_name, participant_id);
+    }
+    else
+    {
+        participant_id = static_cast<ParticipantId>(_participant_names.size());
+        _participant_names.push_back(participant_name);
+        _participant_leaves.emplace_back();
+        _participant_ids.emplace(participant_name, participant_id);
+    }
+
+    auto& leaves = _participant_leaves[participant_id];
+    for (const auto& property : properties)
+    {
+        const auto parsed_path = PropertyPath::parse(property._path);
+        if (!parsed_path || parsed_path->isRoot())
+        {
+            continue;
+        }
+        // the tree keeps the segments and matches them by address
+        const auto path = parsed_path->interned();
+        Node* node = _root.get();
+        for (size_t index = 0; index < path.size(); ++index)
+        {
+            auto& child = node->_children[&path.segment(index)];
+            if (!child)
+            {
+                child = std::make_unique<Node>();
+                child->_parent = node;
+                child->_segment = &path.segment(index);
+                ++_node_count;
+            }
+            node = child.get();
+        }
+
+        const auto type = internString(property._type);
+        const auto value = internString(property._value);
+        auto existing = node->findValue(participant_id);
+        if (existing != node->_values.end() && existing->_participant == participant_id)
+        {
+            releaseString(existing->_type);
+            releaseString(existing->_value);
+            existing->_type = type;
+            existing->_value = value;
+        }
+        else
+        {
+            node->_values.insert(existing, { participant_id, type, value });
+            leaves.push_back(node);
+        }
+    }
+}
+
+void PropertyMirror::removeParticipant(const std::string& participant_name)
+{
+    std::unique_lock<std::shared_mutex> lock(_sync);
+    if (const auto participant_id = findParticipantId(participant_name))
+    {
+        removeParticipantValues(*participant_id);
+        _participant_ids.erase(participant_name);
+        // no value refers to the id anymore, so it is reused by the next participant
+        _participant_names[*participant_id].clear();
+        _participant_leaves[*participant_id].shrink_to_fit();
+        _free_participant_ids.push_back(*participant_id);
+    }
+}
+
+void PropertyMirror::clear()
+{
+    std::unique_lock<std::shared_mutex> lock(_sync);
+    _root = std::make_unique<Node>();
+    _node_count = 0;
+    _strings.clear();
+    _participant_names.clear();
+    _participant_ids.clear();
+    _participant_leaves.clear();
+    _free_participant_ids.clear();
+}
+
+bool PropertyMirror::containsParticipant(const std::string& participant_name) const
+{
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    return findParticipantId(participant_name).has_value();
+}
+
+size_t PropertyMirror::getNodeCount() const
+{
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    return _node_count;
+}
+
+bool PropertyMirror::updateValue(const std::string& participant_name,
+    const PropertyPath& property_path,
+    const std::string& value)
+{
+    std::unique_lock<std::shared_mutex> lock(_sync);
+    const auto participant_id = findParticipantId(participant_name);
+    Node* node = findNode(property_path);
+    if (!participant_id || !node)
+    {
+        return false;
+    }
+    auto existing = node->findValue(*participant_id);
+    if (existing == node->_values.end() || existing->_participant != *participant_id)
+    {
+        return false;
+    }
+    const auto new_value = internString(value);
+    releaseString(existing->_value);
+    existing->_value = new_value;
+    return true;
+}
+
+std::optional<std::string> PropertyMirror::getValue(const std::string& participant_name,
+    const PropertyPath& property_path) const
+{
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    const auto participant_id = findParticipantId(participant_name);
+    Node* node = findNode(property_path);
+    if (!participant_id || !node)
+    {
+        return {};
+    }
+    const auto existing = node->findValue(*participant_id);
+    if (existing == node->_values.end() || existing->_participant != *participant_id)
+    {
+        return {};
+    }
+    return *existing->_value;
+}
+
+std::vector<std::string> PropertyMirror::findParticipants(const PropertyPath& property_path,
+    const std::string& value) const
+{
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    std::vector<std::string> participant_names;
+    const Node* node = findNode(property_path);
+    const auto interned_value = _strings.find(value);
+    if (!node || interned_value == _strings.end())
+    {
+        return participant_names;
+    }
+    // values are deduplicated, so comparing the addresses is enough
+    for (const auto& participant_value : node->_values)
+    {
+        if (participant_value._value == &interned_value->first)
+        {
+            participant_names.push_back(_participant_names[participant_value._participant]);
+        }
+    }
+    std::sort(participant_names.begin(), participant_names.end());
+    return participant_names;
+}
+
+std::map<std::string, PropertyMirror::Values> PropertyMirror::query(const std::string& path_pattern) const
+{
+    // nullptr matches any segment
+    std::vector<const std::string*> pattern;
+    size_t begin = 0;
+    while (begin <= path_pattern.size())
+    {
+        const auto end = std::min(path_pattern.find('/', begin), path_pattern.size());
+        const auto part = std::string_view(path_pattern).substr(begin, end - begin);
+        if (part == "*")
+        {
+            pattern.push_back(nullptr);
+        }
+        else if (!part.empty())
+        {
+            // looked up without interning, a segment never parsed can not be mirrored either
+            const auto segment = PropertyPath::isValid(part) ? PropertyPath::findSegment(part) : nullptr;
+            if (!segment)
+            {
+                return {};
+            }
+            pattern.push_back(segment);
+        }
+        begin = end + 1;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    std::map<std::string, Values> results;
+    std::function<void(const Node&, size_t, const std::string&)> match =
+        [&](const Node& node, size_t index, const std::string& path)
+        {
+            if (index == pattern.size())
+            {
+                for (const auto& participant_value : node._values)
+                {
+                    results[_participant_names[participant_value._participant]][path] = *participant_value._value;
+                }
+                return;
+            }
+            const auto child_path = [&path](const std::string* segment)
+            {
+                return path.empty() ? *segment : path + "/" + *segment;
+            };
+            if (pattern[index])
+            {
+                const auto child = node._children.find(pattern[index]);
+                if (child != node._children.end())
+                {
+                    match(*child->second, index + 1, child_path(child->first));
+                }
+            }
+            else
+            {
+                for (const auto& [segment, child] : node._children)
+                {
+                    match(*child, index + 1, child_path(segment));
+                }
+            }
+        };
+    if (!pattern.empty())
+    {
+        match(*_root, 0, {});
+    }
+    return results;
+}
+
+const std::string* PropertyMirror::internString(const std::string& value)
+{
+    auto interned = _strings.emplace(value, 0).first;
+    ++interned->second;
+    return &interned->first;
+}
+
+void PropertyMirror::releaseString(const std::string* value)
+{
+    auto interned = _strings.find(*value);
+    if (interned != _strings.end() && --interned->second == 0)
+    {
+        _strings.erase(interned);
+    }
+}
+
+void PropertyMirror::removeParticipantValues(ParticipantId participant_id)
+{
+    for (Node* node : _participant_leaves[participant_id])
+    {
+        auto existing = node->findValue(participant_id);
+        if (existing != node->_values.end() && existing->_participant == participant_id)
+        {
+            releaseString(existing->_type);
+            releaseString(existing->_value);
+            node->_values.erase(existing);
+            pruneNode(node);
+        }
+    }
+    _participant_leaves[participant_id].clear();
+}
+
+void PropertyMirror::pruneNode(Node* node)
+{
+    // a node without values and children belongs to no mirrored path anymore
+    while (node->_parent && node->_values.empty() && node->_children.empty())
+    {
+        Node* parent = node->_parent;
+        parent->_children.erase(node->_segment);
+        --_node_count;
+        node = parent;
+    }
+}
+
+std::optional<PropertyMirror::ParticipantId> PropertyMirror::findParticipantId(const std::string& participant_name) const
+{
+    const auto found = _participant_ids.find(participant_name);
+    if (found == _participant_ids.end())
+    {
+        return {};
+    }
+    return found->second;
+}
+
+PropertyMirror::Node* PropertyMirror::findNode(const PropertyPath& property_path) const
+{
+    Node* node = _root.get();
+    for (size_t index = 0; index < property_path.size() && node; ++index)
+    {
+        const auto child = node->_children.find(&property_path.segment(index));
+        node = child != node->_children.end() ? child->second.get() : nullptr;
+    }
+    return node;
+}
+
+} // namespace fep3
@@ -0,0 +1,250 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "property_path.h"
+#include "string_pool.h"
+
+#include <algorithm>
+
+namespace
+{
+/// pool of all segment names ever interned
+fep3::StringPool& getSegmentPool()
+{
+    static fep3::StringPool pool;
+    return pool;
+}
+
+const std::string& getEmptySegment()
+{
+    static const std::string empty;
+    return empty;
+}
+
+bool isSegmentCharacter(char character)
+{
+    return (character >= 'a' && character <= 'z')
+        || (character >= 'A' && character <= 'Z')
+        || (character >= '0' && character <= '9')
+        || character == '_';
+}
+
+bool isSeparator(char character, bool allow_dot_separator)
+{
+    return character == '/' || (allow_dot_separator && character == '.');
+}
+
+/**
+ * @brief Splits a path into its segments and calls @p on_segment for each of them.
+ * Accepts the same paths as the regular expression "([/]?([a-zA-Z0-9_]+[/]?)*)".
+ */
+template<typename OnSegment>
+bool forEachSegment(std::string_view path, bool allow_dot_separator, OnSegment on_segment)
+{
+    size_t position = 0;
+    if (position < path.size() && isSeparator(path[position], allow_dot_separator))
+    {
+        ++position;
+    }
+    while (position < path.size())
+    {
+        const size_t begin = position;
+        while (position < path.size() && isSegmentCharacter(path[position]))
+        {
+            ++position;
+        }
+        if (position == begin)
+        {
+            // empty segment or invalid character
+            return false;
+        }
+        on_segment(path.substr(begin, position - begin));
+        if (position < path.size())
+        {
+            if (!isSeparator(path[position], allow_dot_separator))
+            {
+                return false;
+            }
+            ++position;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace fep3
+{
+
+std::optional<PropertyPath> PropertyPath::parse(std::string_view path, bool allow_dot_separator)
+{
+    std::vector<std::string_view> segments;
+    if (!forEachSegment(path, allow_dot_separator,
+        [&segments](std::string_view segment) { segments.push_back(segment); }))
+    {
+        return {};
+    }
+
+    PropertyPath parsed;
+    parsed._segments.reserve(segments.size());
+    const auto& pool = getSegmentPool();
+    for (const auto& segment : segments)
+    {
+        if (const auto interned_segment = pool.find(segment))
+        {
+            parsed._segments.push_back(interned_segment);
+        }
+        else
+        {
+            parsed._own_segments.push_back(std::make_shared<const std::string>(segment));
+            parsed._segments.push_back(parsed._own_segments.back().get());
+        }
+    }
+    return parsed;
+}
+
+PropertyPath PropertyPath::interned() const
+{
+    PropertyPath interned_path;
+    if (_own_segments.empty())
+    {
+        interned_path._segments = _segments;
+        return interned_path;
+    }
+    interned_path._segments.reserve(_segments.size());
+    auto& pool = getSegmentPool();
+    for (const auto* segment : _segments)
+    {
+        interned_path._segments.push_back(pool.intern(*segment));
+    }
+    return interned_path;
+}
+
+bool PropertyPath::isValid(std::string_view path, bool allow_dot_separator)
+{
+    return forEachSegment(path, allow_dot_separator, [](std::string_view) {});
+}
+
+const std::string* PropertyPath::findSegment(std::string_view segment)
+{
+    return getSegmentPool().find(segment);
+}
+
+bool PropertyPath::isRoot() const
+{
+    return _segments.empty();
+}
+
+size_t PropertyPath::size() const
+{
+    return _segments.size();
+}
+
+const std::string& PropertyPath::segment(size_t index) const
+{
+    return *_segments.at(index);
+}
+
+const std::string& PropertyPath::name() const
+{
+    return _segments.empty() ? getEmptySegment() : *_segments.back();
+}
+
+PropertyPath PropertyPath::parent() const
+{
+    PropertyPath parent_path;
+    if (!_segments.empty())
+    {
+        parent_path._segments.assign(_segments.begin(), _segments.end() - 1);
+        parent_path._own_segments = _own_segments;
+    }
+    return parent_path;
+}
+
+PropertyPath PropertyPath::append(const PropertyPath& relative_path) const
+{
+    PropertyPath appended;
+    appended._segments.reserve(_segments.size() + relative_path._segments.size());
+    appended._segments = _segments;
+    appended._segments.insert(appended._segments.end(),
+        relative_path._segments.begin(),
+        relative_path._segments.end());
+    appended._own_segments = _own_segments;
+    appended._own_segments.insert(appended._own_segments.end(),
+        relative_path._own_segments.begin(),
+        relative_path._own_segments.end());
+    return appended;
+}
+
+std::string PropertyPath::toString() const
+{
+    if (_segments.empty())
+    {
+        return "/";
+    }
+    return "/" + toRelativeString();
+}
+
+std::string PropertyPath::toNodeString() const
+{
+    if (_segments.empty())
+    {
+        return "/";
+    }
+    return toString() + "/";
+}
+
+std::string PropertyPath::toRelativeString() const
+{
+    size_t length = 0;
+    for (const auto* segment : _segments)
+    {
+        length += segment->size() + 1;
+    }
+
+    std::string result;
+    result.reserve(length);
+    for (const auto* segment : _segments)
+    {
+        if (!result.empty())
+        {
+            result += '/';
+        }
+        result += *segment;
+    }
+    return result;
+}
+
+bool PropertyPath::operator==(const PropertyPath& other) const
+{
+    // interned segments are equal if their addresses are equal,
+    // a segment owned by a path may equal one interned after that path was parsed
+    return std::equal(_segments.begin(), _segments.end(), other._segments.begin(), other._segments.end(),
+        [](const std::string* segment, const std::string* other_segment)
+        {
+            return segment == other_segment || *segment == *other_segment;
+        });
+}
+
+bool PropertyPath::operator!=(const PropertyPath& other) const
+{
+    return !(*this == other);
+}
+
+} // namespace fep3
@@ -0,0 +1,84 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief Caches the rpc components of a participant by the iids they support.
+ * The catalog is valid for one generation, bumping the generation makes the next lookup fetch it again.
+ * A catalog which could not be fetched completely is used for the running lookup only.
+ */
+class RPCComponentCatalogCache
+{
+public:
+    using Generation = std::atomic<uint64_t>;
+
+    /// rpc component names by supported iid
+    using Catalog = std::map<std::string, std::vector<std::string>>;
+    /// fills the catalog, returns false if it could not be fetched completely
+    using CatalogFetcher = std::function<bool(Catalog&)>;
+
+    RPCComponentCatalogCache();
+
+    std::vector<std::string> getComponentsWhichSupports(
+        const CatalogFetcher& fetch_catalog,
+        const std::string& iid);
+
+    void refreshIfOutdated(const CatalogFetcher& fetch_catalog);
+
+    /**
+     * @brief Marks the cached catalog as outdated, the next lookup will fetch it again.
+     * Lock free, so it may be called from state machine proxies and service bus callbacks.
+     */
+    void invalidate();
+
+    /**
+     * @brief Returns a callback invalidating this cache, which may safely outlive the cache.
+     */
+    std::function<void()> getInvalidator() const;
+
+    /**
+     * @brief Returns a callback reading the current generation, which may safely outlive the cache.
+     * The callback returns 0 once the cache is gone.
+     */
+    std::function<uint64_t()> getGenerationSource() const;
+
+    void reset();
+
+private:
+    Catalog _found_components_byiid;
+    std::recursive_mutex _sync;
+    //bumped by our own state transitions and by service update events of the participant
+    std::shared_ptr<Generation> _generation;
+    //only set for a complete catalog, so an incomplete one is fetched again
+    uint64_t _cached_generation{ 0 };
+};
+
+} // namespace fep3
@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "rpc_component_catalog_cache.h"
+
+namespace fep3
+{
+RPCComponentCatalogCache::RPCComponentCatalogCache() : _generation(std::make_shared<Generation>(1))
+{
+}
+
+std::vector<std::string> RPCComponentCatalogCache::getComponentsWhichSupports(
+    const CatalogFetcher& fetch_catalog,
+    const std::string& iid)
+{
+    std::lock_guard<std::recursive_mutex> lock(_sync);
+    refreshIfOutdated(fetch_catalog);
+    auto it = _found_components_byiid.find(iid);
+    if (it != _found_components_byiid.end())
+    {
+        return it->second;
+    }
+    //the iid is not supported, or was missing in an incomplete catalog which is fetched again next time
+    return {};
+}
+
+void RPCComponentCatalogCache::refreshIfOutdated(const CatalogFetcher& fetch_catalog)
+{
+    std::lock_guard<std::recursive_mutex> lock(_sync);
+    const auto current_generation = _generation->load();
+    if (current_generation != _cached_generation)
+    {
+        Catalog catalog;
+        const bool complete = fetch_catalog(catalog);
+        _found_components_byiid = std::move(catalog);
+        if (complete)
+        {
+            _cached_generation = current_generation;
+        }
+    }
+}
+
+void RPCComponentCatalogCache::invalidate()
+{
+    _generation->fetch_add(1);
+}
+
+std::function<void()> RPCComponentCatalogCache::getInvalidator() const
+{
+    std::weak_ptr<Generation> generation = _generation;
+    return [generation]()
+    {
+        if (auto locked_generation = generation.lock())
+        {
+            locked_generation->fetch_add(1);
+        }
+    };
+}
+
+std::function<uint64_t()> RPCComponentCatalogCache::getGenerationSource() const
+{
+    std::weak_ptr<Generation> generation = _generation;
+    return [generation]() -> uint64_t
+    {
+        if (auto locked_generation = generation.lock())
+        {
+            return locked_generation->load();
+        }
+        return 0;
+    };
+}
+
+void RPCComponentCatalogCache::reset()
+{
+    std::lock_guard<std::recursive_mutex> lock(_sync);
+    _found_components_byiid.clear();
+    invalidate();
+}
+
+} // namespace fep3
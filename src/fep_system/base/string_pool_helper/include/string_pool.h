@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace fep3
+{
+/**
+ * @brief Thread safe pool of interned strings, equal strings are stored once.
+ * Lookups of known strings only take a shared lock and do not allocate, so the pool
+ * may be used on hot paths which see the same few names over and over again.
+ * The pool only grows, the interned strings are valid for the lifetime of the pool.
+ */
+class StringPool
+{
+public:
+    /// @return the interned copy of @p value, the same pointer for equal strings
+    const std::string* intern(std::string_view value);
+    /// @return the interned copy of @p value, nullptr if it was never interned
+    const std::string* find(std::string_view value) const;
+
+private:
+    mutable std::shared_mutex _sync;
+    /// the keys refer to the owned strings, which are not moved on rehashing
+    std::unordered_map<std::string_view, std::unique_ptr<const std::string>> _strings;
+};
+
+} // namespace fep3
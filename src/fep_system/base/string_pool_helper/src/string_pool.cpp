@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "string_pool.h"
+
+#include <mutex>
+
+namespace fep3
+{
+const std::string* StringPool::intern(std::string_view value)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(_sync);
+        const auto found = _strings.find(value);
+        if (found != _strings.end())
+        {
+            return found->second.get();
+        }
+    }
+    auto interned = std::make_unique<const std::string>(value);
+    std::unique_lock<std::shared_mutex> lock(_sync);
+    // another thread may have inserted the same string in the meantime
+    const auto inserted = _strings.try_emplace(*interned, std::move(interned)).first;
+    return inserted->second.get();
+}
+
+const std::string* StringPool::find(std::string_view value) const
+{
+    std::shared_lock<std::shared_mutex> lock(_sync);
+    const auto found = _strings.find(value);
+    return found != _strings.end() ? found->second.get() : nullptr;
+}
+
+} // namespace fep3
@@ -0,0 +1,159 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace fep3
+{
+/**
+ * @brief Bounded lock free queue for many producers and one consumer.
+ * Each cell carries a sequence number telling whether it is free for the producer of a position
+ * or filled for the consumer of a position, so producers and the consumer only synchronize
+ * on the cell they access (see D. Vyukov's bounded MPMC queue).
+ * Since popping is safe from several threads as well, a producer may pop the oldest
+ * value itself to make room.
+ *
+ * @tparam T the values, default constructible and move assignable
+ */
+template<typename T>
+class BoundedMpscQueue
+{
+public:
+    /// @param[in] capacity the maximum number of values, rounded up to a power of two (at least 2)
+    explicit BoundedMpscQueue(size_t capacity)
+        : _capacity(roundUpToPowerOfTwo(capacity))
+        , _mask(_capacity - 1)
+        , _cells(new Cell[_capacity])
+    {
+        for (size_t position = 0; position < _capacity; ++position)
+        {
+            _cells[position]._sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    /// @return false if the queue is full, @p value is left untouched then
+    bool tryPush(T&& value)
+    {
+        size_t position = _push_position.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;)
+        {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if (_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = _push_position.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @return false if the queue is empty or the oldest value is not completely pushed yet
+    bool tryPop(T& value)
+    {
+        size_t position = _pop_position.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;)
+        {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0)
+            {
+                if (_pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = _pop_position.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = T{};
+        cell->_sequence.store(position + _capacity, std::memory_order_release);
+        return true;
+    }
+
+    /// approximate while values are pushed or popped
+    size_t size() const
+    {
+        const auto push_position = _push_position.load(std::memory_order_relaxed);
+        const auto pop_position = _pop_position.load(std::memory_order_relaxed);
+        return push_position > pop_position ? push_position - pop_position : 0;
+    }
+
+    size_t capacity() const
+    {
+        return _capacity;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> _sequence{ 0 };
+        T _value{};
+    };
+
+    static size_t roundUpToPowerOfTwo(size_t capacity)
+    {
+        size_t power_of_two = 2;
+        while (power_of_two < capacity)
+        {
+            power_of_two <<= 1;
+        }
+        return power_of_two;
+    }
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+    // the producers and the consumer do not share a cache line
+    alignas(64) std::atomic<size_t> _push_position{ 0 };
+    alignas(64) std::atomic<size_t> _pop_position{ 0 };
+};
+
+} // namespace fep3
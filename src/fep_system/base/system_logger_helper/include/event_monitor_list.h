@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "fep_system/event_monitor_intf.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace fep3
+{
+/**
+ * @brief The event monitors of a system logger, each with its own filter.
+ * The list is copied on every change and published atomically, so dispatching a log record
+ * does not lock the list. Only the monitors passing the record are locked, one at a time,
+ * which serializes the calls of one monitor and lets @ref remove wait for a running call.
+ */
+class EventMonitorList
+{
+public:
+    /// adds the monitor, or replaces the filter if it is added already
+    void add(IEventMonitor& monitor, const EventMonitorFilter& filter = {});
+    /// the monitor is not called anymore when this returns, unless called from within its own onLogRecord
+    /// @return false if the monitor was not added
+    bool remove(IEventMonitor& monitor);
+    void clear();
+    size_t size() const;
+
+    /// passes the record to the matching monitors, see @ref IEventMonitor::onLogRecord
+    void dispatch(const LogRecord& record) const;
+
+private:
+    /// the call state of a monitor, kept when its filter is replaced
+    struct Slot
+    {
+        /// recursive, since a monitor may log to the system within onLogRecord
+        std::recursive_mutex _sync;
+        bool _active = true;
+    };
+
+    /// a monitor with its filter compiled for matching
+    struct Entry
+    {
+        Entry(IEventMonitor& monitor, const EventMonitorFilter& filter, std::shared_ptr<Slot> slot);
+        bool matches(LoggerSeverity level, const std::string& participant_name, const std::string& logger_name) const;
+
+        IEventMonitor& _monitor;
+        const int _max_severity;
+        const bool _all_participants;
+        const std::unordered_set<std::string> _participant_names;
+        const std::string _logger_name_prefix;
+        /// shared by all filters of the monitor, so its calls stay serialized
+        const std::shared_ptr<Slot> _slot;
+    };
+    using Entries = std::vector<std::shared_ptr<const Entry>>;
+
+    void deactivate(Slot& slot);
+
+    /// serializes the writers
+    mutable std::mutex _sync;
+    /// accessed with std::atomic_load and std::atomic_store only
+    std::shared_ptr<const Entries> _entries = std::make_shared<const Entries>();
+};
+
+} // namespace fep3
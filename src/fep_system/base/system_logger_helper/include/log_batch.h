@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "fep_system/system_logger_intf.h"
+
+#include <json/json.h>
+#include <string>
+
+namespace fep3
+{
+/**
+ * @brief Passes the log records of one participant received by the batched log sink to @p logger.
+ * Every record is an array of [timestamp in ns, severity, logger name, description].
+ * Malformed records, including severities outside fatal..debug, are skipped.
+ * Well formed records below the severity level of @p logger are filtered.
+ *
+ * @param[in] logger the system logger to pass the records to
+ * @param[in] participant the name of the participant which logged the records
+ * @param[in] records the array of records
+ * @return the number of well formed records
+ */
+int logRecordBatch(const ISystemLogger& logger, const std::string& participant, const Json::Value& records);
+
+} // namespace fep3
@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include "bounded_mpsc_queue.h"
+#include "fep_system/system_logger_intf.h"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace fep3
+{
+/**
+ * @brief Counters shared by the dispatchers of one system logger, so they survive a reconfiguration.
+ */
+struct LogDispatchCounters
+{
+    std::atomic<uint64_t> _delivered{ 0 };
+    std::atomic<uint64_t> _dropped{ 0 };
+    std::atomic<uint64_t> _blocked{ 0 };
+};
+
+/**
+ * @brief Delivers log records on a dedicated thread, so the logging threads (i.e. the rpc server thread
+ * receiving the log records of the participants) do not wait for a slow receiver.
+ * Pushing is lock free unless the queue is full and the overflow policy is LogOverflowPolicy::block.
+ * A record pushed by the dispatcher thread itself (i.e. logged within the delivery) never blocks,
+ * it drops the oldest record instead.
+ */
+class LogDispatcher
+{
+public:
+    using Delivery = std::function<void(const LogRecord&)>;
+
+    /**
+     * @param[in] capacity the maximum number of queued records
+     * @param[in] overflow_policy what happens if the queue is full
+     * @param[in] counters the counters to update, they have to outlive the dispatcher
+     * @param[in] delivery called on the dispatcher thread for every record, exceptions are swallowed
+     */
+    LogDispatcher(size_t capacity, LogOverflowPolicy overflow_policy, LogDispatchCounters& counters, Delivery delivery);
+    /// delivers the queued records before the dispatcher thread is stopped.
+    /// If destroyed from within the delivery (i.e. the last reference is dropped by a monitor),
+    /// the dispatcher thread is detached instead, it returns after the running delivery
+    /// and counts the records still queued as dropped.
+    ~LogDispatcher();
+
+    LogDispatcher(const LogDispatcher&) = delete;
+    LogDispatcher& operator=(const LogDispatcher&) = delete;
+
+    void push(LogRecord&& record);
+
+    size_t getQueuedCount() const;
+    size_t getCapacity() const;
+    LogOverflowPolicy getOverflowPolicy() const;
+
+private:
+    /// shared with the dispatcher thread, so a detached thread does not outlive it
+    struct State
+    {
+        State(size_t capacity, LogOverflowPolicy overflow_policy, LogDispatchCounters& counters, Delivery delivery);
+
+        BoundedMpscQueue<LogRecord> _queue;
+        const LogOverflowPolicy _overflow_policy;
+        LogDispatchCounters& _counters;
+        const Delivery _delivery;
+
+        std::mutex _sync;
+        /// signals the dispatcher thread a pushed record or the stop
+        std::condition_variable _not_empty;
+        /// signals the blocked producers a popped record
+        std::condition_variable _not_full;
+        std::atomic<bool> _dispatcher_waiting{ false };
+        std::atomic<uint32_t> _blocked_producers{ 0 };
+        std::atomic<bool> _stop{ false };
+        /// the dispatcher was destroyed from within the delivery
+        std::atomic<bool> _detached{ false };
+    };
+
+    static void run(const std::shared_ptr<State>& state);
+    static void deliver(State& state, const LogRecord& record);
+
+    const std::shared_ptr<State> _state;
+    std::thread _thread;
+};
+
+} // namespace fep3
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <string>
+
+namespace fep3
+{
+/**
+ * @brief Interns the participant and logger names of the log records, see @ref LogRecord.
+ * The table only grows, the interned names are valid for the lifetime of the process.
+ * The number of distinct names is bounded by the participants and their loggers.
+ */
+class LogNameTable
+{
+public:
+    /// @return the interned copy of @p name, the same pointer for equal names
+    static const std::string* intern(const std::string& name);
+};
+
+} // namespace fep3
@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "event_monitor_list.h"
+
+#include <algorithm>
+
+namespace fep3
+{
+EventMonitorList::Entry::Entry(IEventMonitor& monitor, const EventMonitorFilter& filter, std::shared_ptr<Slot> slot)
+    : _monitor(monitor)
+    , _max_severity(static_cast<int>(filter._severity))
+    , _all_participants(filter._participant_names.empty())
+    , _participant_names(filter._participant_names.begin(), filter._participant_names.end())
+    , _logger_name_prefix(filter._logger_name_prefix)
+    , _slot(std::move(slot))
+{
+}
+
+bool EventMonitorList::Entry::matches(LoggerSeverity level,
+    const std::string& participant_name,
+    const std::string& logger_name) const
+{
+    // cheapest criteria first
+    const auto severity = static_cast<int>(level);
+    if (severity > _max_severity || level == LoggerSeverity::off)
+    {
+        return false;
+    }
+    if (logger_name.compare(0, _logger_name_prefix.size(), _logger_name_prefix) != 0)
+    {
+        return false;
+    }
+    return _all_participants || _participant_names.count(participant_name) != 0;
+}
+
+void EventMonitorList::add(IEventMonitor& monitor, const EventMonitorFilter& filter)
+{
+    std::lock_guard<std::mutex> lock(_sync);
+    auto entries = std::make_shared<Entries>(*std::atomic_load(&_entries));
+    const auto found = std::find_if(entries->begin(), entries->end(),
+        [&monitor](const std::shared_ptr<const Entry>& entry) { return &entry->_monitor == &monitor; });
+    if (found != entries->end())
+    {
+        // a dispatch of the previous list may still use the old filter, but locks the same slot
+        *found = std::make_shared<const Entry>(monitor, filter, (*found)->_slot);
+    }
+    else
+    {
+        entries->push_back(std::make_shared<const Entry>(monitor, filter, std::make_shared<Slot>()));
+    }
+    std::atomic_store(&_entries, std::shared_ptr<const Entries>(std::move(entries)));
+}
+
+bool EventMonitorList::remove(IEventMonitor& monitor)
+{
+    std::shared_ptr<const Entry> removed;
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        auto entries = std::make_shared<Entries>(*std::atomic_load(&_entries));
+        const auto found = std::find_if(entries->begin(), entries->end(),
+            [&monitor](const std::shared_ptr<const Entry>& entry) { return &entry->_monitor == &monitor; });
+        if (found == entries->end())
+        {
+            return false;
+        }
+        removed = *found;
+        entries->erase(found);
+        std::atomic_store(&_entries, std::shared_ptr<const Entries>(std::move(entries)));
+    }
+    deactivate(*removed->_slot);
+    return true;
+}
+
+void EventMonitorList::clear()
+{
+    std::shared_ptr<const Entries> removed;
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        removed = std::atomic_load(&_entries);
+        std::atomic_store(&_entries, std::make_shared<const Entries>());
+    }
+    for (const auto& entry : *removed)
+    {
+        deactivate(*entry->_slot);
+    }
+}
+
+size_t EventMonitorList::size() const
+{
+    return std::atomic_load(&_entries)->size();
+}
+
+void EventMonitorList::dispatch(const LogRecord& record) const
+{
+    const auto entries = std::atomic_load(&_entries);
+    for (const auto& entry : *entries)
+    {
+        if (entry->matches(record._severity, record.getParticipantName(), record.getLoggerName()))
+        {
+            std::lock_guard<std::recursive_mutex> lock(entry->_slot->_sync);
+            // removed since the list was loaded
+            if (entry->_slot->_active)
+            {
+                entry->_monitor.onLogRecord(record);
+            }
+        }
+    }
+}
+
+void EventMonitorList::deactivate(Slot& slot)
+{
+    // waits for a running call of the monitor
+    std::lock_guard<std::recursive_mutex> lock(slot._sync);
+    slot._active = false;
+}
+
+} // namespace fep3
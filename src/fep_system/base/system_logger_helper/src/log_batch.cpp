@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_batch.h"
+#include "log_name_table.h"
+
+namespace fep3
+{
+namespace
+{
+bool isWellFormed(const Json::Value& record)
+{
+    // the value types and ranges are checked, as* throws for an array, an object or a value out of range
+    return record.isArray() && record.size() == 4
+        && record[0].isInt64() && record[1].isInt()
+        && record[1].asInt() >= static_cast<int>(LoggerSeverity::fatal)
+        && record[1].asInt() <= static_cast<int>(LoggerSeverity::debug)
+        && record[2].isString() && record[3].isString();
+}
+} // namespace
+
+int logRecordBatch(const ISystemLogger& logger, const std::string& participant, const Json::Value& records)
+{
+    if (!records.isArray())
+    {
+        return 0;
+    }
+    int accepted = 0;
+    for (const auto& record : records)
+    {
+        if (!isWellFormed(record))
+        {
+            continue;
+        }
+        ++accepted;
+        const auto severity = static_cast<LoggerSeverity>(record[1].asInt());
+        if (!logger.isSeverityEnabled(severity))
+        {
+            continue;
+        }
+        logger.log(LogRecord(
+            std::chrono::nanoseconds(record[0].asInt64()),
+            severity,
+            LogNameTable::intern(participant),
+            LogNameTable::intern(record[2].asString()),
+            record[3].asString()));
+    }
+    return accepted;
+}
+
+} // namespace fep3
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_dispatcher.h"
+
+namespace fep3
+{
+namespace
+{
+// the blocked producers and the idle dispatcher thread check again in case a notification is missed
+constexpr auto blocked_recheck_interval = std::chrono::milliseconds(10);
+constexpr auto idle_recheck_interval = std::chrono::milliseconds(100);
+} // namespace
+
+LogDispatcher::State::State(size_t capacity,
+                            LogOverflowPolicy overflow_policy,
+                            LogDispatchCounters& counters,
+                            Delivery delivery)
+    : _queue(capacity)
+    , _overflow_policy(overflow_policy)
+    , _counters(counters)
+    , _delivery(std::move(delivery))
+{
+}
+
+LogDispatcher::LogDispatcher(size_t capacity,
+                             LogOverflowPolicy overflow_policy,
+                             LogDispatchCounters& counters,
+                             Delivery delivery)
+    : _state(std::make_shared<State>(capacity, overflow_policy, counters, std::move(delivery)))
+{
+    _thread = std::thread([state = _state]() { run(state); });
+}
+
+LogDispatcher::~LogDispatcher()
+{
+    const bool within_delivery = std::this_thread::get_id() == _thread.get_id();
+    {
+        std::lock_guard<std::mutex> lock(_state->_sync);
+        _state->_detached = within_delivery;
+        _state->_stop = true;
+    }
+    _state->_not_empty.notify_one();
+    if (within_delivery)
+    {
+        // joining would join this thread itself, it keeps the state alive until it returns
+        _thread.detach();
+    }
+    else
+    {
+        _thread.join();
+    }
+}
+
+void LogDispatcher::push(LogRecord&& record)
+{
+    State& state = *_state;
+    if (!state._queue.tryPush(std::move(record)))
+    {
+        if (state._overflow_policy == LogOverflowPolicy::block && std::this_thread::get_id() != _thread.get_id())
+        {
+            ++state._counters._blocked;
+            std::unique_lock<std::mutex> lock(state._sync);
+            ++state._blocked_producers;
+            while (!state._queue.tryPush(std::move(record)))
+            {
+                state._not_full.wait_for(lock, blocked_recheck_interval);
+            }
+            --state._blocked_producers;
+        }
+        else
+        {
+            LogRecord oldest;
+            do
+            {
+                if (state._queue.tryPop(oldest))
+                {
+                    ++state._counters._dropped;
+                }
+            } while (!state._queue.tryPush(std::move(record)));
+        }
+    }
+    if (state._dispatcher_waiting)
+    {
+        // the lock makes sure the dispatcher thread is waiting already or checks the queue again
+        std::lock_guard<std::mutex> lock(state._sync);
+        state._not_empty.notify_one();
+    }
+}
+
+size_t LogDispatcher::getQueuedCount() const
+{
+    return _state->_queue.size();
+}
+
+size_t LogDispatcher::getCapacity() const
+{
+    return _state->_queue.capacity();
+}
+
+LogOverflowPolicy LogDispatcher::getOverflowPolicy() const
+{
+    return _state->_overflow_policy;
+}
+
+void LogDispatcher::run(const std::shared_ptr<State>& state)
+{
+    LogRecord record;
+    for (;;)
+    {
+        while (state->_queue.tryPop(record))
+        {
+            if (state->_blocked_producers)
+            {
+                std::lock_guard<std::mutex> lock(state->_sync);
+                state->_not_full.notify_all();
+            }
+            deliver(*state, record);
+            if (state->_detached)
+            {
+                // the dispatcher was dropped from within the delivery, nobody waits for the queued records
+                while (state->_queue.tryPop(record))
+                {
+                    ++state->_counters._dropped;
+                }
+                return;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(state->_sync);
+        if (state->_stop)
+        {
+            // the queued records are delivered before stopping
+            if (state->_queue.size() == 0)
+            {
+                return;
+            }
+            continue;
+        }
+        state->_dispatcher_waiting = true;
+        if (state->_queue.size() == 0)
+        {
+            state->_not_empty.wait_for(lock, idle_recheck_interval);
+        }
+        state->_dispatcher_waiting = false;
+    }
+}
+
+void LogDispatcher::deliver(State& state, const LogRecord& record)
+{
+    try
+    {
+        state._delivery(record);
+    }
+    catch (...)
+    {
+        // a failing receiver must not stop the delivery of the following records
+    }
+    ++state._counters._delivered;
+}
+
+} // namespace fep3
@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_name_table.h"
+#include "string_pool.h"
+
+namespace fep3
+{
+const std::string* LogNameTable::intern(const std::string& name)
+{
+    // never destroyed, so the names stay valid for records logged during the static destruction
+    static StringPool* pool = new StringPool();
+    return pool->intern(name);
+}
+
+} // namespace fep3
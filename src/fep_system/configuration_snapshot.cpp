@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "configuration_snapshot.h"
+
+#include <json/json.h>
+#include <stdexcept>
+
+namespace
+{
+    constexpr const char* const snapshot_format = "fep3_system_configuration";
+}
+
+namespace fep3
+{
+    ConfigurationSnapshotWriter::ConfigurationSnapshotWriter(const std::string& file_path, const std::string& system_name) :
+        _file_path(file_path),
+        _stream(file_path, std::ios::out | std::ios::trunc | std::ios::binary)
+    {
+        if (!_stream)
+        {
+            throw std::runtime_error("configuration snapshot file " + file_path + " can not be opened for writing");
+        }
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "";
+        _writer.reset(builder.newStreamWriter());
+
+        Json::Value header;
+        header["format"] = snapshot_format;
+        header["version"] = configuration_snapshot_version;
+        header["system"] = system_name;
+        writeLine(header);
+    }
+
+    ConfigurationSnapshotWriter::~ConfigurationSnapshotWriter() = default;
+
+    void ConfigurationSnapshotWriter::write(const SnapshotParticipant& participant)
+    {
+        // checked before anything is written, the file stays readable
+        for (const auto& property : participant._properties)
+        {
+            if (property._type.empty())
+            {
+                throw std::runtime_error("property " + property._path + " of " + participant._name
+                    + " has no type and can not be saved to the configuration snapshot");
+            }
+        }
+        Json::Value participant_line;
+        participant_line["participant"] = participant._name;
+        participant_line["init_priority"] = participant._init_priority;
+        participant_line["start_priority"] = participant._start_priority;
+        participant_line["property_count"] = static_cast<Json::UInt64>(participant._properties.size());
+        writeLine(participant_line);
+
+        // properties are written as compact arrays [path, type, value]
+        Json::Value property_line(Json::arrayValue);
+        property_line.resize(3);
+        for (const auto& property : participant._properties)
+        {
+            property_line[0] = property._path;
+            property_line[1] = property._type;
+            property_line[2] = property._value;
+            writeLine(property_line);
+        }
+        _stream.flush();
+        if (!_stream)
+        {
+            throw std::runtime_error("configuration snapshot file " + _file_path + " can not be written");
+        }
+    }
+
+    void ConfigurationSnapshotWriter::writeLine(const Json::Value& value)
+    {
+        _writer->write(value, &_stream);
+        _stream << '\n';
+    }
+
+    ConfigurationSnapshotReader::ConfigurationSnapshotReader(const std::string& file_path) :
+        _file_path(file_path),
+        _stream(file_path, std::ios::in | std::ios::binary),
+        _reader(Json::CharReaderBuilder().newCharReader())
+    {
+        if (!_stream)
+        {
+            throw std::runtime_error("configuration snapshot file " + file_path + " can not be opened for reading");
+        }
+        Json::Value header;
+        if (!readLine(header)
+            || header["format"].asString() != snapshot_format)
+        {
+            throw std::runtime_error(file_path + " is not a configuration snapshot file");
+        }
+        if (!header["version"].isUInt() || header["version"].asUInt() != configuration_snapshot_version)
+        {
+            throw std::runtime_error("configuration snapshot file " + file_path + " has the unsupported version "
+                + header["version"].asString());
+        }
+        _system_name = header["system"].asString();
+    }
+
+    ConfigurationSnapshotReader::~ConfigurationSnapshotReader() = default;
+
+    const std::string& ConfigurationSnapshotReader::getSystemName() const
+    {
+        return _system_name;
+    }
+
+    bool ConfigurationSnapshotReader::read(SnapshotParticipant& participant)
+    {
+        Json::Value participant_line;
+        if (!readLine(participant_line))
+        {
+            return false;
+        }
+        if (!participant_line.isObject() || !participant_line["participant"].isString())
+        {
+            throw std::runtime_error("configuration snapshot file " + _file_path + " is malformed at line "
+                + std::to_string(_line_number) + ", participant expected");
+        }
+        participant._name = participant_line["participant"].asString();
+        participant._init_priority = participant_line["init_priority"].asInt();
+        participant._start_priority = participant_line["start_priority"].asInt();
+
+        if (!participant_line["property_count"].isUInt64())
+        {
+            throw std::runtime_error("configuration snapshot file " + _file_path + " is malformed at line "
+                + std::to_string(_line_number) + ", property count of " + participant._name + " expected");
+        }
+        // not reserved, the count is only trusted as far as the property lines follow
+        const auto property_count = participant_line["property_count"].asUInt64();
+        participant._properties.clear();
+        Json::Value property_line;
+        for (uint64_t index = 0; index < property_count; ++index)
+        {
+            if (!readLine(property_line) || !property_line.isArray() || property_line.size() != 3
+                || !property_line[0].isString() || !property_line[1].isString() || !property_line[2].isString()
+                || property_line[1].asString().empty())
+            {
+                throw std::runtime_error("configuration snapshot file " + _file_path + " is malformed at line "
+                    + std::to_string(_line_number) + ", property of " + participant._name + " expected");
+            }
+            participant._properties.push_back({ property_line[0].asString(),
+                property_line[1].asString(),
+                property_line[2].asString() });
+        }
+        return true;
+    }
+
+    bool ConfigurationSnapshotReader::readLine(Json::Value& value)
+    {
+        while (std::getline(_stream, _line))
+        {
+            ++_line_number;
+            if (_line.empty() || _line == "\r")
+            {
+                continue;
+            }
+            std::string errors;
+            if (!_reader->parse(_line.data(), _line.data() + _line.size(), &value, &errors))
+            {
+                throw std::runtime_error("configuration snapshot file " + _file_path + " is malformed at line "
+                    + std::to_string(_line_number) + ": " + errors);
+            }
+            return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Json
+{
+class Value;
+class StreamWriter;
+class CharReader;
+}
+
+namespace fep3
+{
+    /// the version written to and accepted from configuration snapshot files
+    constexpr uint32_t configuration_snapshot_version = 1;
+
+    struct SnapshotProperty
+    {
+        std::string _path;
+        std::string _type;
+        std::string _value;
+    };
+
+    struct SnapshotParticipant
+    {
+        std::string _name;
+        int32_t _init_priority = 0;
+        int32_t _start_priority = 0;
+        std::vector<SnapshotProperty> _properties;
+    };
+
+    /**
+     * @brief Writes a configuration snapshot file participant by participant.
+     * The file consists of one JSON value per line: a header with format and version,
+     * then per participant a line with name and priorities followed by one line per property.
+     */
+    class ConfigurationSnapshotWriter
+    {
+    public:
+        /// @throw std::runtime_error if the file can not be opened
+        ConfigurationSnapshotWriter(const std::string& file_path, const std::string& system_name);
+        ~ConfigurationSnapshotWriter();
+
+        /// @throw std::runtime_error if the file can not be written or a property has no type
+        void write(const SnapshotParticipant& participant);
+
+    private:
+        void writeLine(const Json::Value& value);
+
+        std::string _file_path;
+        std::ofstream _stream;
+        std::unique_ptr<Json::StreamWriter> _writer;
+    };
+
+    /**
+     * @brief Reads a configuration snapshot file participant by participant.
+     */
+    class ConfigurationSnapshotReader
+    {
+    public:
+        /// @throw std::runtime_error if the file can not be opened or has an unsupported format or version
+        explicit ConfigurationSnapshotReader(const std::string& file_path);
+        ~ConfigurationSnapshotReader();
+
+        const std::string& getSystemName() const;
+
+        /**
+         * @brief Reads the next participant.
+         *
+         * @param[out] participant the participant read
+         * @return @c false if the end of the file is reached
+         * @throw std::runtime_error if the file is malformed
+         */
+        bool read(SnapshotParticipant& participant);
+
+    private:
+        bool readLine(Json::Value& value);
+
+        std::string _file_path;
+        std::ifstream _stream;
+        std::unique_ptr<Json::CharReader> _reader;
+        std::string _system_name;
+        std::string _line;
+        uint64_t _line_number = 0;
+    };
+}
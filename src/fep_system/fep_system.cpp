@@ -29,17 +29,29 @@ You may add additional accurate notices of copyright ownership.
 #include "a_util/process.h"
 #include "system_logger.h"
 #include <map>
+#include <set>
 #include <mutex>
 #include <thread>
 #include <algorithm>
 #include <iterator>
 #include <functional>
 #include <numeric>
+#include <limits>
 #include <boost/bimap.hpp>
 #include <boost/assign.hpp>
 
 #include "system_discovery_helper.h"
 #include "participant_health_aggregator.h"
+#include "health_fetch_queue.h"
+#include "health_notifier.h"
+#include "liveliness_tracker.h"
+#include "service_update_dispatcher.h"
+#include "simulation_progress_monitor.h"
+#include "participant_health_listener.h"
+#include "property_path.h"
+#include "property_mirror.h"
+#include "clock_offset_estimator.h"
+#include "configuration_snapshot.h"
 
 #include <fep3/components/clock/clock_service_intf.h>
 #include <fep3/components/clock_sync/clock_sync_service_intf.h>
@@ -48,6 +60,8 @@ You may add additional accurate notices of copyright ownership.
 #include <fep3/base/properties/properties.h>
 
 const uint8_t pool_size_for_parallel_ops = 6;
+// number of participants held in memory at once while saving or restoring a configuration snapshot
+const size_t snapshot_chunk_size = 4 * pool_size_for_parallel_ops;
 
 using namespace a_util::strings;
 
@@ -237,7 +251,13 @@ namespace fep3
               _execution_config{},
               _service_bus_wrapper(getServiceBusWrapper())
         {
-            _service_bus_wrapper.createOrGetServiceBusConnection(system_name, system_discovery_url);
+            auto service_bus = _service_bus_wrapper.createOrGetServiceBusConnection(system_name, system_discovery_url);
+            // the liveliness tracker receives the update events of the participants through the dispatcher
+            auto system_access = service_bus ? service_bus->getSystemAccessCatelyn(system_name) : nullptr;
+            if (system_access)
+            {
+                _service_update_dispatcher = getServiceUpdateDispatcher(system_access);
+            }
             _logger->initRPCService(_system_name);
         }
 
@@ -247,11 +267,15 @@ namespace fep3
         // why move constructor is not called?
         Implementation& operator=(Implementation&& other)
         {
+            // stops tracking the participants of the former system
+            clear();
             _system_name = std::move(other._system_name);
             _system_discovery_url = std::move(other._system_discovery_url);
             _participants = std::move(other._participants);
             _logger = std::move(other._logger);
             _service_bus_wrapper = other._service_bus_wrapper;
+            _service_update_dispatcher = other._service_update_dispatcher;
+            participantsChanged();
             return *this;
         }
 
@@ -829,10 +853,10 @@ namespace fep3
             return getAggregatedState(getParticipantStates(timeout));
         }
 
-        void registerMonitoring(IEventMonitor* monitor)
+        void registerMonitoring(IEventMonitor& monitor, const EventMonitorFilter& filter)
         {
             // register first in case a warning has to be logged
-            _logger->registerMonitor(monitor);
+            _logger->registerMonitor(monitor, filter);
 
             for (const auto& participant : _participants)
             {
@@ -845,19 +869,150 @@ namespace fep3
             }
         }
 
-        void releaseMonitoring()
+        void unregisterMonitoring(IEventMonitor& monitor)
         {
-            _logger->releaseMonitor();
+            _logger->unregisterMonitor(monitor);
         }
 
-        void setSeverityLevel(LoggerSeverity level)
+        void setSeverityLevel(LoggerSeverity level, bool apply_to_participants)
         {
             _logger->setSeverityLevel(level);
+            if (!apply_to_participants)
+            {
+                return;
+            }
+            boost::asio::thread_pool pool(pool_size_for_parallel_ops);
+            for (const auto& participant : _participants)
+            {
+                boost::asio::post(pool,
+                    [&]()
+                    {
+                        try
+                        {
+                            auto logging_service = participant.getRPCComponentProxyByIID<rpc::IRPCLoggingService>();
+                            throwIfNotValid<rpc::IRPCLoggingService>(logging_service);
+                            // keeps the sinks, the rpc sink delivers the records to the system
+                            auto filter = logging_service->getLoggerFilter({});
+                            if (filter._enabled_logging_sinks.empty())
+                            {
+                                throw std::runtime_error("the logger filter could not be read");
+                            }
+                            filter._severity = level;
+                            if (!logging_service->setLoggerFilter({}, filter))
+                            {
+                                throw std::runtime_error("the logger filter could not be set");
+                            }
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            FEP3_SYSTEM_LOG(_logger,
+                                LoggerSeverity::warning,
+                                participant.getName(),
+                                _system_name,
+                                std::string("Could not apply the severity level: ") + ex.what());
+                        }
+                    });
+            }
+            pool.join();
+        }
+
+        LoggerSeverity getSeverityLevel() const
+        {
+            return _logger->getSeverityLevel();
+        }
+
+        void setAsyncLogging(const AsyncLoggingConfig& config)
+        {
+            _logger->setAsyncLogging(config);
+        }
+
+        AsyncLoggingConfig getAsyncLogging() const
+        {
+            return _logger->getAsyncLogging();
+        }
+
+        LoggingMetrics getLoggingMetrics() const
+        {
+            return _logger->getLoggingMetrics();
         }
 
         void clear()
         {
             _participants.clear();
+            _property_mirror.clear();
+            participantsChanged();
+        }
+
+        /// to be called whenever @ref _participants changed, the health notifier works on its own copy
+        void participantsChanged()
+        {
+            std::set<std::string> participant_names;
+            for (const auto& participant : _participants)
+            {
+                if (participant)
+                {
+                    participant_names.insert(participant.getName());
+                }
+            }
+            // the liveliness tracker gets the service update events of the system's participants only
+            for (const auto& participant_name : _tracked_participants)
+            {
+                if (participant_names.count(participant_name) == 0)
+                {
+                    if (_service_update_dispatcher)
+                    {
+                        _service_update_dispatcher->deregisterSink(_system_name, participant_name, &_liveliness_tracker);
+                    }
+                    _liveliness_tracker.removeParticipant(participant_name);
+                }
+            }
+            for (const auto& participant : _participants)
+            {
+                if (participant && _tracked_participants.count(participant.getName()) == 0)
+                {
+                    // the update events received by the health listener so far
+                    std::chrono::steady_clock::time_point last_alive_time;
+                    try
+                    {
+                        last_alive_time = participant.getParticipantHealthSince(std::numeric_limits<uint64_t>::max()).system_time;
+                    }
+                    catch (const std::exception&)
+                    {
+                        // deactivated health listener, the participant is online with its next update event
+                    }
+                    _liveliness_tracker.addParticipant(participant.getName(), last_alive_time);
+                    participant.setHealthHistoryCapacity(_health_history_capacity);
+                    if (_service_update_dispatcher)
+                    {
+                        _service_update_dispatcher->registerSink(_system_name, participant.getName(), &_liveliness_tracker);
+                    }
+                }
+            }
+
+            auto participants = std::make_shared<const std::vector<ParticipantProxy>>(_participants);
+            std::lock_guard<std::mutex> lock(_health_sync);
+            for (const auto& participant_name : _tracked_participants)
+            {
+                if (participant_names.count(participant_name) == 0)
+                {
+                    _running_state_versions.erase(participant_name);
+                }
+            }
+            _tracked_participants = std::move(participant_names);
+            _health_notifier_participants = std::move(participants);
+        }
+
+        void runningStateChanged(const std::string& participant_name)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_health_sync);
+                const auto version = _running_state_versions.find(participant_name);
+                if (version != _running_state_versions.end())
+                {
+                    version->second = nextHealthVersion();
+                }
+            }
+            signalHealthUpdate();
         }
 
         void addAsync(const std::multimap<std::string, std::string>& participants, uint8_t pool_size)
@@ -890,11 +1045,13 @@ namespace fep3
                             _system_name,
                             _system_discovery_url,
                             _logger,
-                            PARTICIPANT_DEFAULT_TIMEOUT);
+                            PARTICIPANT_DEFAULT_TIMEOUT,
+                            _simulation_progress_monitor);
                     });
                 ++index;
             }
             pool.join();
+            participantsChanged();
         }
 
         void add(const std::string& participant_name, const std::string& participant_url)
@@ -914,7 +1071,9 @@ namespace fep3
                 _system_name,
                 _system_discovery_url,
                 _logger,
-                PARTICIPANT_DEFAULT_TIMEOUT));
+                PARTICIPANT_DEFAULT_TIMEOUT,
+                _simulation_progress_monitor));
+            participantsChanged();
         }
 
         void remove(const std::string& participant_name)
@@ -933,6 +1092,8 @@ namespace fep3
             {
                 _participants.erase(found);
             }
+            _property_mirror.removeParticipant(participant_name);
+            participantsChanged();
         }
 
         ParticipantProxy getParticipant(const std::string& participant_name, bool throw_if_not_found) const
@@ -996,16 +1157,30 @@ namespace fep3
             return mapToProxyVec();
         }
 
+        // parses a property path given by the user, '.' and '/' are both accepted as separator
+        PropertyPath parsePropertyPath(const std::string& property_path) const
+        {
+            auto parsed_path = PropertyPath::parse(property_path, true);
+            if (!parsed_path)
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger,
+                    LoggerSeverity::error,
+                    "",
+                    _system_name,
+                    format("property path %s is invalid", property_path.c_str()));
+            }
+            return *parsed_path;
+        }
+
         // common parts for setParticipantProperty and getParticipantProperty
-        std::pair<std::shared_ptr<IProperties>, std::string> getParticipantProperties(const std::string& participant_name,
-            const std::string& property_path,
+        std::pair<std::shared_ptr<IProperties>, std::string> getPropertiesNode(const std::string& participant_name,
+            const PropertyPath& property_path,
             const ParticipantProxy& part) const
         {
             if (part) {
                 // split property_path in property_node and property_name
-                auto pos_name = property_path.find_last_of("/");
-                auto property_node = property_path.substr(0, pos_name);
-                auto property_name = (pos_name == std::string::npos) ? "" : property_path.substr(pos_name + 1);
+                const auto property_node = property_path.parent().toString();
+                const auto& property_name = property_path.name();
 
                 // get properties of participant
                 using IRPCConfiguration = fep3::rpc::IRPCConfiguration;
@@ -1026,7 +1201,7 @@ namespace fep3
                     format("participant %s within system %s not found to configure %s",
                         participant_name.c_str(),
                         _system_name.c_str(),
-                        property_path.c_str()));
+                        property_path.toString().c_str()));
             }
         }
 
@@ -1035,278 +1210,867 @@ namespace fep3
             const std::string& property_value,
             const bool throw_if_not_found) const
         {
-            std::string property_path_normalized = property_path;
-            a_util::strings::replace(property_path_normalized, ".", "/");
+            const auto property_path_normalized = parsePropertyPath(property_path);
             ParticipantProxy part = getParticipant(participant_name, throw_if_not_found);
-            auto [props, property_name] = getParticipantProperties(participant_name, property_path_normalized, part);
+            auto [props, property_name] = getPropertiesNode(participant_name, property_path_normalized, part);
 
             if (!props->setProperty(property_name, property_value, props->getPropertyType(property_name))) {
                         const auto message = format("property %s could not be set for the following participant: %s"
-                    , property_path_normalized.c_str()
+                    , property_path_normalized.toRelativeString().c_str()
                     , part.getName().c_str());
                 throw std::runtime_error(message);
             }
+            _property_mirror.updateValue(participant_name, property_path_normalized, property_value);
         }
 
         std::string getParticipantProperty(const std::string& participant_name,
                                            const std::string& property_path) const
         {
-            std::string property_path_normalized = property_path;
-            a_util::strings::replace(property_path_normalized, ".", "/");
+            const auto property_path_normalized = parsePropertyPath(property_path);
             ParticipantProxy part = getParticipant(participant_name, true);
-            auto [props, property_name] = getParticipantProperties(participant_name, property_path_normalized, part);
+            auto [props, property_name] = getPropertiesNode(participant_name, property_path_normalized, part);
             return props->getProperty(property_name);
         }
 
-        SystemAggregatedState getParticipantState(const std::string& participant_name)
+        PropertyAccessResults setParticipantProperties(const ParticipantPropertyValues& property_values) const
         {
-            ParticipantProxy participant(getParticipant(participant_name, true));
-            ParticipantStates states = getParticipantStates(std::chrono::milliseconds(0),
-                std::vector<ParticipantProxy>{participant});
-            return states.empty() ? SystemAggregatedState::undefined : states[participant.getName()];
+            auto results = accessPropertiesConcurrently(property_values,
+                [](fep3::rpc::IRPCConfiguration& config, const PropertyValues& values, PropertyAccessResult& result)
+                {
+                    PropertiesNodes nodes(config);
+                    for (const auto& [property_path, property_value] : values)
+                    {
+                        try
+                        {
+                            auto [props, property_name] = nodes.get(property_path);
+                            const auto type = props->getPropertyType(property_name);
+                            if (type.empty())
+                            {
+                                result._errors[property_path] = "property does not exist";
+                            }
+                            else if (!props->setProperty(property_name, property_value, type))
+                            {
+                                result._errors[property_path] = "property could not be set";
+                            }
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            result._errors[property_path] = ex.what();
+                        }
+                    }
+                });
+            for (const auto& [participant_name, values] : property_values)
+            {
+                for (const auto& [property_path, property_value] : values)
+                {
+                    updatePropertyMirror(participant_name, property_path, property_value, results.at(participant_name));
+                }
+            }
+            return results;
         }
 
-        ParticipantStates getParticipantStates(std::chrono::milliseconds timeout)
+        struct TypedPropertyValue
         {
-            return getParticipantStates(timeout, _participants);
-        }
+            std::string _path;
+            std::string _value;
+            std::string _type;
+        };
+        using TypedPropertyValues = std::vector<TypedPropertyValue>;
 
-        void setParticipantState(const std::string& participant_name, const SystemAggregatedState participant_state)
+        // sets the properties in the given order with the given types, without looking the types up
+        PropertyAccessResults setTypedPropertiesConcurrently(const std::map<std::string, TypedPropertyValues>& property_values) const
         {
-            auto part = getParticipant(participant_name, true);
-            if (part) {
-                // create a second temporary system with only one participant
-                fep3::System tmp_system(this->getName());
-                tmp_system.add(participant_name);
-
-                if (participant_state == fep3::SystemAggregatedState::unreachable) {
-                    tmp_system.setSystemState(fep3::SystemAggregatedState::unloaded);
-                    tmp_system.shutdown();
-                    _participants.erase(std::find(begin(_participants), end(_participants), part));
-                }
-                else {
-                    tmp_system.setSystemState(participant_state);
+            auto results = accessPropertiesConcurrently(property_values,
+                [](fep3::rpc::IRPCConfiguration& config, const TypedPropertyValues& values, PropertyAccessResult& result)
+                {
+                    auto root = config.getProperties("/");
+                    if (!root)
+                    {
+                        throw std::runtime_error("access to properties node / not possible");
+                    }
+                    for (const auto& value : values)
+                    {
+                        if (!root->setProperty(value._path, value._value, value._type))
+                        {
+                            result._errors[value._path] = "property could not be set";
+                        }
+                    }
+                });
+            for (const auto& [participant_name, values] : property_values)
+            {
+                for (const auto& value : values)
+                {
+                    updatePropertyMirror(participant_name, value._path, value._value, results.at(participant_name));
                 }
             }
+            return results;
         }
 
-        void setPropertyValueToAll(const std::string& node,
-            const std::string& property_name,
-            const std::string& value,
-            const std::string& type,
-            const std::string& except_participant = std::string(),
-            const bool throw_on_failure = true) const
+        PropertyAccessResults getParticipantProperties(const ParticipantPropertyPaths& property_paths) const
         {
-            std::string property_normalized = property_name;
-            a_util::strings::replace(property_normalized, ".", "/");
-            auto failing_participants = std::vector<std::string>();
-
-            for (const ParticipantProxy& participant : getParticipants())
-            {
-                if (!except_participant.empty())
+            return accessPropertiesConcurrently(property_paths,
+                [](fep3::rpc::IRPCConfiguration& config, const std::vector<std::string>& paths, PropertyAccessResult& result)
                 {
-                    if (participant.getName() == except_participant)
+                    for (const auto& property_path : paths)
                     {
-                        continue;
+                        try
+                        {
+                            const auto parsed_path = PropertyPath::parse(property_path, true);
+                            if (!parsed_path)
+                            {
+                                result._errors[property_path] = "property path is invalid";
+                                continue;
+                            }
+                            // value and type are read with one request, an empty type means it does not exist
+                            std::string value, type;
+                            config.getPropertyValue(parsed_path->toString(), value, type);
+                            if (type.empty())
+                            {
+                                result._errors[property_path] = "property does not exist";
+                            }
+                            else
+                            {
+                                result._values[property_path] = std::move(value);
+                            }
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            result._errors[property_path] = ex.what();
+                        }
                     }
-                }
+                });
+        }
 
-                try
+        ConfigurationApplyResults applyDesiredConfiguration(const ParticipantPropertyValues& desired_values) const
+        {
+            auto results = accessPropertiesConcurrently<ConfigurationApplyResult>(desired_values,
+                [](fep3::rpc::IRPCConfiguration& config, const PropertyValues& values, ConfigurationApplyResult& result)
                 {
-                    using IRPCConfiguration = fep3::rpc::IRPCConfiguration;
-                    auto config_rpc_client = participant.getRPCComponentProxyByIID<IRPCConfiguration>();
-                    throwIfNotValid<IRPCConfiguration>(config_rpc_client);
-
-                    auto props = config_rpc_client->getProperties(node);
-                    if (props)
+                    struct DesiredValue
+                    {
+                        std::string _name;
+                        const std::string* _path;
+                        const std::string* _value;
+                    };
+                    std::map<std::string, std::vector<DesiredValue>> values_by_node;
+                    for (const auto& [property_path, property_value] : values)
                     {
-                        const auto success = props->setProperty(property_normalized, value, type);
-                        if (!success)
+                        const auto parsed_path = PropertyPath::parse(property_path, true);
+                        if (!parsed_path)
                         {
-                            failing_participants.push_back(participant.getName());
+                            result._errors[property_path] = "property path is invalid";
+                            continue;
                         }
+                        values_by_node[parsed_path->parent().toString()].push_back(
+                            { parsed_path->name(), &property_path, &property_value });
                     }
-                }
-                catch (const std::exception& /*exception*/)
-                {
-                    failing_participants.push_back(participant.getName());
-                }
-            }
 
-            if (!failing_participants.empty())
-            {
-                const auto participants = join(failing_participants, ", ");
-                const auto message = format("property %s could not be set for the following participants: %s"
-                    , property_normalized.c_str()
-                    , participants.c_str());
+                    for (const auto& [node_path, desired] : values_by_node)
+                    {
+                        try
+                        {
+                            auto props = config.getProperties(node_path);
+                            if (!props)
+                            {
+                                throw std::runtime_error(format("access to properties node %s not possible", node_path.c_str()));
+                            }
+                            // one bulk read of the node instead of one request per property
+                            base::Properties<IProperties> current_values;
+                            props->copyTo(current_values);
 
-                if (throw_on_failure)
+                            for (const auto& desired_value : desired)
+                            {
+                                const auto type = current_values.getPropertyType(desired_value._name);
+                                if (type.empty())
+                                {
+                                    result._errors[*desired_value._path] = "property does not exist";
+                                }
+                                else if (current_values.getProperty(desired_value._name) == *desired_value._value)
+                                {
+                                    ++result._skipped;
+                                }
+                                else if (props->setProperty(desired_value._name, *desired_value._value, type))
+                                {
+                                    ++result._written;
+                                }
+                                else
+                                {
+                                    result._errors[*desired_value._path] = "property could not be set";
+                                }
+                            }
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            for (const auto& desired_value : desired)
+                            {
+                                result._errors[*desired_value._path] = ex.what();
+                            }
+                        }
+                    }
+                });
+            for (const auto& [participant_name, values] : desired_values)
+            {
+                for (const auto& [property_path, property_value] : values)
                 {
-                    throw std::runtime_error(message);
+                    updatePropertyMirror(participant_name, property_path, property_value, results.at(participant_name));
                 }
-
-                FEP3_SYSTEM_LOG(_logger,
-                    LoggerSeverity::warning,
-                    "",
-                    _system_name,
-                    message);
             }
+            return results;
         }
 
-        void configureTiming(const std::string& master_clock_name, const std::string& slave_clock_name,
-            const std::string& scheduler, const std::string& master_element_id, const std::string& master_time_stepsize,
-            const std::string& master_time_factor, const std::string& slave_sync_cycle_time) const
+        PropertyAccessResults saveConfiguration(const std::string& file_path) const
         {
-            setPropertyValueToAll("/",
-                FEP3_CLOCKSYNC_SERVICE_CONFIG_TIMING_MASTER,
-                master_element_id, fep3::base::PropertyType<std::string>::getTypeName());
-            setPropertyValueToAll("/",
-                FEP3_SCHEDULER_SERVICE_SCHEDULER,
-                scheduler, fep3::base::PropertyType<std::string>::getTypeName());
+            ConfigurationSnapshotWriter writer(file_path, _system_name);
+            PropertyAccessResults results;
 
-            if (!master_element_id.empty())
+            std::vector<SnapshotParticipant> chunk;
+            chunk.reserve(snapshot_chunk_size);
+            auto write_chunk = [&]()
             {
-                setPropertyValueToAll("/",
-                    FEP3_CLOCK_SERVICE_MAIN_CLOCK,
-                    slave_clock_name, fep3::base::PropertyType<std::string>::getTypeName(), master_element_id);
-                setParticipantProperty(master_element_id,
-                    "/" FEP3_CLOCK_SERVICE_MAIN_CLOCK,
-                    master_clock_name, false);
-                if (!master_time_factor.empty())
-                {
-                    setParticipantProperty(master_element_id,
-                        "/" FEP3_CLOCK_SERVICE_CLOCK_SIM_TIME_TIME_FACTOR,
-                        master_time_factor, false);
-                }
-                if (!master_time_stepsize.empty())
+                std::map<std::string, SnapshotParticipant*> destinations;
+                for (auto& snapshot : chunk)
                 {
-                    setParticipantProperty(master_element_id,
-                        "/" FEP3_CLOCK_SERVICE_CLOCK_SIM_TIME_STEP_SIZE,
-                        master_time_stepsize, false);
+                    destinations.emplace(snapshot._name, &snapshot);
                 }
-                if (!slave_sync_cycle_time.empty())
+                auto chunk_results = accessPropertiesConcurrently(destinations,
+                    [](fep3::rpc::IRPCConfiguration& config, SnapshotParticipant* const& destination, PropertyAccessResult& result)
+                    {
+                        const auto tree = config.getPropertyTree("/");
+                        const auto names = tree->getPropertyNames();
+                        destination->_properties.reserve(names.size());
+                        for (const auto& name : names)
+                        {
+                            auto type = tree->getPropertyType(name);
+                            if (type.empty())
+                            {
+                                // could not be restored, so the participant is not saved
+                                result._errors[name] = "property has no type";
+                                continue;
+                            }
+                            destination->_properties.push_back({ name, std::move(type), tree->getProperty(name) });
+                        }
+                    });
+                for (const auto& snapshot : chunk)
                 {
-                    setPropertyValueToAll("/",
-                        FEP3_CLOCKSYNC_SERVICE_CONFIG_SLAVE_SYNC_CYCLE_TIME,
-                        slave_sync_cycle_time, fep3::base::PropertyType<int64_t>::getTypeName(), master_element_id);
+                    if (chunk_results[snapshot._name]._errors.empty())
+                    {
+                        writer.write(snapshot);
+                    }
                 }
-            }
-            else
-            {
-                setPropertyValueToAll("/",
-                    FEP3_CLOCK_SERVICE_MAIN_CLOCK, slave_clock_name, fep3::base::PropertyType<std::string>::getTypeName());
-            }
-        }
+                results.merge(chunk_results);
+                chunk.clear();
+            };
 
-        std::vector<std::string> getCurrentTimingMasters() const
-        {
-            std::vector<std::string> timing_masters_found;
-            for (ParticipantProxy participant : getParticipants())
+            for (const auto& participant : _participants)
             {
-                using IRPCConfiguration = fep3::rpc::IRPCConfiguration;
-                auto config_rpc_client = participant.getRPCComponentProxyByIID<IRPCConfiguration>();
-                throwIfNotValid<IRPCConfiguration>(config_rpc_client);
-
-                auto props = config_rpc_client->getProperties(FEP3_CLOCKSYNC_SERVICE_CONFIG);
-                if (props)
+                chunk.push_back({ participant.getName(), participant.getInitPriority(), participant.getStartPriority(), {} });
+                if (chunk.size() == snapshot_chunk_size)
                 {
-                    auto master_found = props->getProperty(FEP3_TIMING_MASTER_PROPERTY);
-                    if (!master_found.empty())
-                    {
-                        auto found_it = std::find(timing_masters_found.cbegin(), timing_masters_found.cend(), master_found);
-                        if (found_it != timing_masters_found.cend())
-                        {
-                            //is already in list
-                        }
-                        else
-                        {
-                            timing_masters_found.push_back(master_found);
-                        }
-                    }
+                    write_chunk();
                 }
             }
-            return timing_masters_found;
+            write_chunk();
+            return results;
         }
 
-        std::map<std::string, std::unique_ptr<IProperties>> getTimingProperties() const
+        ConfigurationApplyResults restoreConfiguration(const std::string& file_path)
         {
-            std::map<std::string, std::unique_ptr<IProperties>> timing_properties;
-            for (const ParticipantProxy& participant : getParticipants())
+            ConfigurationSnapshotReader reader(file_path);
+            ConfigurationApplyResults results;
+
+            std::map<std::string, SnapshotParticipant> chunk;
+            auto restore_chunk = [&]()
             {
-                auto iterator_success = timing_properties.emplace(participant.getName(),
-                    std::unique_ptr<IProperties>(new base::Properties<IProperties>()));
-                if (!iterator_success.second)
+                for (const auto& [participant_name, snapshot] : chunk)
                 {
-                    FEP3_SYSTEM_LOG_AND_THROW(_logger, LoggerSeverity::fatal, "", _system_name,
-                        "Multiple Participants with the name " + participant.getName() + " found");
-                }
-                IProperties& participant_properties = *iterator_success.first->second;
-                auto set_if_present = [&participant_properties](const fep3::arya::IProperties& properties, const std::string& config_name) {
-                    auto value = properties.getProperty(config_name);
-                    if (value.empty())
+                    auto participant = getParticipant(participant_name, false);
+                    if (participant)
                     {
-                        return false;
+                        participant.setInitPriority(snapshot._init_priority);
+                        participant.setStartPriority(snapshot._start_priority);
                     }
-                    return participant_properties.setProperty(config_name, value, properties.getPropertyType(config_name));
-                };
-
-                using IRPCConfiguration = fep3::rpc::IRPCConfiguration;
-                auto config_rpc_client = participant.getRPCComponentProxyByIID<IRPCConfiguration>();
-                throwIfNotValid<IRPCConfiguration>(config_rpc_client);
-
-                auto clockservice_props = config_rpc_client->getProperties(FEP3_CLOCK_SERVICE_CONFIG);
-                if (clockservice_props)
-                {
-                    set_if_present(*clockservice_props, FEP3_MAIN_CLOCK_PROPERTY);
                 }
-                auto clocksync_props = config_rpc_client->getProperties(FEP3_CLOCKSYNC_SERVICE_CONFIG);
-                if (clocksync_props)
-                {
-                    if (set_if_present(*clocksync_props, FEP3_TIMING_MASTER_PROPERTY))
+                auto chunk_results = accessPropertiesConcurrently<ConfigurationApplyResult>(chunk,
+                    [](fep3::rpc::IRPCConfiguration& config, const SnapshotParticipant& snapshot, ConfigurationApplyResult& result)
                     {
-                        if (clockservice_props)
+                        // one bulk read of the whole tree instead of one request per property
+                        const auto current_values = config.getPropertyTree("/");
+                        PropertiesNodes nodes(config);
+                        for (const auto& property : snapshot._properties)
                         {
-                            set_if_present(*clockservice_props, FEP3_CLOCK_SIM_TIME_TIME_FACTOR_PROPERTY);
-                            set_if_present(*clockservice_props, FEP3_CLOCK_SIM_TIME_STEP_SIZE_PROPERTY);
-                            set_if_present(*clockservice_props, FEP3_TIME_UPDATE_TIMEOUT_PROPERTY);
+                            try
+                            {
+                                if (current_values->getPropertyType(property._path).empty())
+                                {
+                                    result._errors[property._path] = "property does not exist";
+                                }
+                                else if (current_values->getProperty(property._path) == property._value)
+                                {
+                                    ++result._skipped;
+                                }
+                                else
+                                {
+                                    auto [node, property_name] = nodes.get(property._path);
+                                    if (node->setProperty(property_name, property._value, property._type))
+                                    {
+                                        ++result._written;
+                                    }
+                                    else
+                                    {
+                                        result._errors[property._path] = "property could not be set";
+                                    }
+                                }
+                            }
+                            catch (const std::exception& ex)
+                            {
+                                result._errors[property._path] = ex.what();
+                            }
                         }
-                        set_if_present(*clocksync_props, FEP3_SLAVE_SYNC_CYCLE_TIME_PROPERTY);
+                    });
+                for (const auto& [participant_name, snapshot] : chunk)
+                {
+                    for (const auto& property : snapshot._properties)
+                    {
+                        updatePropertyMirror(participant_name, property._path, property._value, chunk_results.at(participant_name));
                     }
-
                 }
-                auto scheduler_props = config_rpc_client->getProperties(FEP3_SCHEDULER_SERVICE_CONFIG);
-                if (scheduler_props)
+                results.merge(chunk_results);
+                chunk.clear();
+            };
+
+            SnapshotParticipant snapshot;
+            while (reader.read(snapshot))
+            {
+                auto name = snapshot._name;
+                chunk[name] = std::move(snapshot);
+                if (chunk.size() == snapshot_chunk_size)
                 {
-                    set_if_present(*scheduler_props, FEP3_SCHEDULER_PROPERTY);
+                    restore_chunk();
                 }
             }
-            return timing_properties;
+            restore_chunk();
+            return results;
         }
 
-        void setInitAndStartPolicy(ExecutionConfig execution_config)
+        PropertyAccessResults refreshPropertyMirror() const
         {
-            if (execution_config._thread_count > 0)
+            std::map<std::string, std::string> participant_names;
+            for (const auto& participant : _participants)
             {
-                _execution_config = execution_config;
+                participant_names.emplace(participant.getName(), participant.getName());
             }
-            else
+            const auto results = accessPropertiesConcurrently(participant_names,
+                [this](fep3::rpc::IRPCConfiguration& config, const std::string& participant_name, PropertyAccessResult&)
+                {
+                    const auto tree = config.getPropertyTree("/");
+                    const auto names = tree->getPropertyNames();
+                    std::vector<PropertyMirror::Property> properties;
+                    properties.reserve(names.size());
+                    for (const auto& name : names)
+                    {
+                        properties.push_back({ name, tree->getPropertyType(name), tree->getProperty(name) });
+                    }
+                    _property_mirror.setParticipant(participant_name, properties);
+                });
+            for (const auto& [participant_name, result] : results)
             {
-                throw std::runtime_error("thread count with value 0 is not valid");
+                if (!result._errors.empty())
+                {
+                    // outdated values are worse than none
+                    _property_mirror.removeParticipant(participant_name);
+                }
             }
+            return results;
         }
 
-        ExecutionConfig getInitAndStartPolicy() const
+        ParticipantPropertyValues queryMirroredProperties(const std::string& path_pattern) const
         {
-            return _execution_config;
+            return _property_mirror.query(path_pattern);
         }
 
-        std::chrono::milliseconds getHeartbeatInterval(const std::string& participant)
+        std::vector<std::string> findParticipantsByMirroredProperty(const std::string& property_path,
+            const std::string& property_value) const
         {
-            auto part = getParticipant(participant, false);
-            if (part)
-            {
+            return _property_mirror.findParticipants(parsePropertyPath(property_path), property_value);
+        }
 
-                auto http_server_rpc = part.getRPCComponentProxyByIID<fep3::rpc::IRPCHttpServer>();
+        // keeps the mirror current after own writes, failed properties are left untouched
+        template<typename Result>
+        void updatePropertyMirror(const std::string& participant_name,
+            const std::string& property_path,
+            const std::string& property_value,
+            const Result& result) const
+        {
+            if (result._errors.count("") == 0 && result._errors.count(property_path) == 0)
+            {
+                if (const auto parsed_path = PropertyPath::parse(property_path, true))
+                {
+                    _property_mirror.updateValue(participant_name, *parsed_path, property_value);
+                }
+            }
+        }
+
+        template<typename Request>
+        std::map<std::string, Request> toAllParticipants(const Request& request) const
+        {
+            std::map<std::string, Request> requests;
+            for (const auto& participant : _participants)
+            {
+                requests.emplace(participant.getName(), request);
+            }
+            return requests;
+        }
+
+        /**
+         * @brief Resolves the properties nodes of one participant, every node only once.
+         */
+        class PropertiesNodes
+        {
+        public:
+            explicit PropertiesNodes(fep3::rpc::IRPCConfiguration& config) : _config(config)
+            {
+            }
+
+            // @throw runtime_error if the path is invalid or the node does not exist
+            std::pair<std::shared_ptr<IProperties>, std::string> get(const std::string& property_path)
+            {
+                const auto parsed_path = PropertyPath::parse(property_path, true);
+                if (!parsed_path)
+                {
+                    throw std::runtime_error("property path is invalid");
+                }
+                const auto node_path = parsed_path->parent().toString();
+                auto& node = _nodes[node_path];
+                if (!node)
+                {
+                    node = _config.getProperties(node_path);
+                    if (!node)
+                    {
+                        throw std::runtime_error(format("access to properties node %s not possible", node_path.c_str()));
+                    }
+                }
+                return { node, parsed_path->name() };
+            }
+
+        private:
+            fep3::rpc::IRPCConfiguration& _config;
+            std::map<std::string, std::shared_ptr<IProperties>> _nodes;
+        };
+
+        /**
+         * @brief Runs @p access for every participant of @p requests, at most pool_size_for_parallel_ops
+         * participants at once. Errors are collected per participant in Result::_errors, nothing is thrown.
+         */
+        template<typename Result = PropertyAccessResult, typename Request, typename Access>
+        std::map<std::string, Result> accessPropertiesConcurrently(const std::map<std::string, Request>& requests, Access access) const
+        {
+            struct Task
+            {
+                std::string _participant_name;
+                ParticipantProxy _participant;
+                const Request* _request;
+                Result _result;
+            };
+            // the participants are resolved before, the worker threads only touch their own task
+            std::vector<Task> tasks;
+            tasks.reserve(requests.size());
+            for (const auto& [participant_name, request] : requests)
+            {
+                tasks.push_back({ participant_name, getParticipant(participant_name, false), &request, {} });
+            }
+
+            {
+                boost::asio::thread_pool pool(pool_size_for_parallel_ops);
+                for (auto& task : tasks)
+                {
+                    boost::asio::post(pool,
+                        [&task, &access]()
+                        {
+                            const ParticipantProxy& participant = task._participant;
+                            if (!participant)
+                            {
+                                task._result._errors[""] = "participant not found";
+                                return;
+                            }
+                            try
+                            {
+                                using IRPCConfiguration = fep3::rpc::IRPCConfiguration;
+                                auto config_rpc_client = participant.getRPCComponentProxyByIID<IRPCConfiguration>();
+                                if (!config_rpc_client)
+                                {
+                                    task._result._errors[""] = "participant is not reachable or has no configuration service";
+                                    return;
+                                }
+                                access(*config_rpc_client, *task._request, task._result);
+                            }
+                            catch (const std::exception& ex)
+                            {
+                                task._result._errors[""] = ex.what();
+                            }
+                        });
+                }
+                pool.join();
+            }
+
+            std::map<std::string, Result> results;
+            for (auto& task : tasks)
+            {
+                if (!task._result._errors.empty())
+                {
+                    FEP3_SYSTEM_LOG(_logger,
+                        LoggerSeverity::warning,
+                        task._participant_name,
+                        _system_name,
+                        format("%d properties could not be accessed", static_cast<int>(task._result._errors.size())));
+                }
+                results.emplace(task._participant_name, std::move(task._result));
+            }
+            return results;
+        }
+
+        SystemAggregatedState getParticipantState(const std::string& participant_name)
+        {
+            ParticipantProxy participant(getParticipant(participant_name, true));
+            ParticipantStates states = getParticipantStates(std::chrono::milliseconds(0),
+                std::vector<ParticipantProxy>{participant});
+            return states.empty() ? SystemAggregatedState::undefined : states[participant.getName()];
+        }
+
+        ParticipantStates getParticipantStates(std::chrono::milliseconds timeout)
+        {
+            return getParticipantStates(timeout, _participants);
+        }
+
+        void setParticipantState(const std::string& participant_name, const SystemAggregatedState participant_state)
+        {
+            auto part = getParticipant(participant_name, true);
+            if (part) {
+                // create a second temporary system with only one participant
+                fep3::System tmp_system(this->getName());
+                tmp_system.add(participant_name);
+
+                if (participant_state == fep3::SystemAggregatedState::unreachable) {
+                    tmp_system.setSystemState(fep3::SystemAggregatedState::unloaded);
+                    tmp_system.shutdown();
+                    _participants.erase(std::find(begin(_participants), end(_participants), part));
+                    participantsChanged();
+                }
+                else {
+                    tmp_system.setSystemState(participant_state);
+                }
+            }
+        }
+
+        void configureTiming(const std::string& master_clock_name, const std::string& slave_clock_name,
+            const std::string& scheduler, const std::string& master_element_id, const std::string& master_time_stepsize,
+            const std::string& master_time_factor, const std::string& slave_sync_cycle_time) const
+        {
+            if (!master_element_id.empty() && !getParticipant(master_element_id, false))
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger,
+                    LoggerSeverity::fatal,
+                    "",
+                    _system_name,
+                    format("participant %s within system %s not found to configure the timing",
+                        master_element_id.c_str(),
+                        _system_name.c_str()));
+            }
+
+            const std::string string_type = fep3::base::PropertyType<std::string>::getTypeName();
+            const std::string int64_type = fep3::base::PropertyType<int64_t>::getTypeName();
+            const std::string double_type = fep3::base::PropertyType<double>::getTypeName();
+
+            // compute the complete property set of every participant first, then apply all of them in one pass
+            std::map<std::string, TypedPropertyValues> property_values;
+            for (const auto& participant : _participants)
+            {
+                const auto participant_name = participant.getName();
+                auto& values = property_values[participant_name];
+                values.push_back({ FEP3_CLOCKSYNC_SERVICE_CONFIG_TIMING_MASTER, master_element_id, string_type });
+                values.push_back({ FEP3_SCHEDULER_SERVICE_SCHEDULER, scheduler, string_type });
+
+                if (master_element_id.empty())
+                {
+                    values.push_back({ FEP3_CLOCK_SERVICE_MAIN_CLOCK, slave_clock_name, string_type });
+                }
+                else if (participant_name == master_element_id)
+                {
+                    values.push_back({ FEP3_CLOCK_SERVICE_MAIN_CLOCK, master_clock_name, string_type });
+                    if (!master_time_factor.empty())
+                    {
+                        values.push_back({ FEP3_CLOCK_SERVICE_CLOCK_SIM_TIME_TIME_FACTOR, master_time_factor, double_type });
+                    }
+                    if (!master_time_stepsize.empty())
+                    {
+                        values.push_back({ FEP3_CLOCK_SERVICE_CLOCK_SIM_TIME_STEP_SIZE, master_time_stepsize, int64_type });
+                    }
+                }
+                else
+                {
+                    values.push_back({ FEP3_CLOCK_SERVICE_MAIN_CLOCK, slave_clock_name, string_type });
+                    if (!slave_sync_cycle_time.empty())
+                    {
+                        values.push_back({ FEP3_CLOCKSYNC_SERVICE_CONFIG_SLAVE_SYNC_CYCLE_TIME, slave_sync_cycle_time, int64_type });
+                    }
+                }
+            }
+
+            const auto results = setTypedPropertiesConcurrently(property_values);
+
+            std::vector<std::string> failures;
+            for (const auto& [participant_name, result] : results)
+            {
+                for (const auto& [property_path, error] : result._errors)
+                {
+                    failures.push_back(format("%s (%s%s%s)",
+                        participant_name.c_str(),
+                        property_path.c_str(),
+                        property_path.empty() ? "" : ": ",
+                        error.c_str()));
+                }
+            }
+            if (!failures.empty())
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger,
+                    LoggerSeverity::error,
+                    "",
+                    _system_name,
+                    "timing properties could not be set for the following participants: " + join(failures, ", "));
+            }
+        }
+
+        std::vector<std::string> getCurrentTimingMasters() const
+        {
+            const auto results = getParticipantProperties(
+                toAllParticipants(std::vector<std::string>{ FEP3_CLOCKSYNC_SERVICE_CONFIG_TIMING_MASTER }));
+
+            std::vector<std::string> timing_masters_found;
+            // keep the order of the participants
+            for (const auto& participant : _participants)
+            {
+                const auto& result = results.at(participant.getName());
+                throwIfParticipantFailed(participant.getName(), result);
+                auto master_found = result._values.find(FEP3_CLOCKSYNC_SERVICE_CONFIG_TIMING_MASTER);
+                if (master_found != result._values.end() && !master_found->second.empty())
+                {
+                    if (std::find(timing_masters_found.cbegin(), timing_masters_found.cend(), master_found->second)
+                        == timing_masters_found.cend())
+                    {
+                        timing_masters_found.push_back(master_found->second);
+                    }
+                }
+            }
+            return timing_masters_found;
+        }
+
+        ClockOffsetResults measureClockOffsets(uint32_t rounds, std::string reference_participant) const
+        {
+            if (rounds == 0)
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger, LoggerSeverity::error, "", _system_name,
+                    "at least one round is needed to measure the clock offsets");
+            }
+            if (reference_participant.empty())
+            {
+                const auto timing_masters = getCurrentTimingMasters();
+                if (timing_masters.size() != 1)
+                {
+                    FEP3_SYSTEM_LOG_AND_THROW(_logger, LoggerSeverity::error, "", _system_name,
+                        format("the clock offsets need a unique timing master as reference, but %d timing masters are configured",
+                            static_cast<int>(timing_masters.size())));
+                }
+                reference_participant = timing_masters.front();
+            }
+            // throws if not found
+            getParticipant(reference_participant, true);
+
+            struct Task
+            {
+                ParticipantProxy _participant;
+                ClockOffsetEstimator _estimator;
+                std::string _error;
+            };
+            std::vector<Task> tasks;
+            tasks.reserve(_participants.size());
+            for (const auto& participant : _participants)
+            {
+                tasks.push_back({ participant, {}, {} });
+            }
+
+            {
+                // every sample carries its own send and receive time, so waiting for a worker
+                // does not bias the offset of a participant
+                boost::asio::thread_pool pool(pool_size_for_parallel_ops);
+                for (auto& task : tasks)
+                {
+                    boost::asio::post(pool,
+                        [&task, rounds]()
+                        {
+                            try
+                            {
+                                auto clock_rpc = task._participant.getRPCComponentProxyByIID<rpc::IRPCClockService>();
+                                throwIfNotValid<rpc::IRPCClockService>(clock_rpc);
+                                // the first request may resolve the rpc component, it is not a sample
+                                clock_rpc->getTime({});
+                                for (uint32_t round = 0; round < rounds; ++round)
+                                {
+                                    const auto local_send = std::chrono::steady_clock::now().time_since_epoch();
+                                    const auto remote_time = clock_rpc->getTime({});
+                                    const auto local_receive = std::chrono::steady_clock::now().time_since_epoch();
+                                    if (remote_time >= 0)
+                                    {
+                                        task._estimator.addSample(local_send, std::chrono::nanoseconds(remote_time), local_receive);
+                                    }
+                                }
+                                if (!task._estimator.hasEstimate())
+                                {
+                                    task._error = "the time of the main clock could not be retrieved";
+                                }
+                            }
+                            catch (const std::exception& ex)
+                            {
+                                task._error = ex.what();
+                            }
+                        });
+                }
+                pool.join();
+            }
+
+            const auto reference = std::find_if(tasks.begin(), tasks.end(),
+                [&](const Task& task) { return task._participant.getName() == reference_participant; });
+            if (!reference->_error.empty())
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger, LoggerSeverity::error, reference_participant, _system_name,
+                    "the clock of the reference participant could not be measured: " + reference->_error);
+            }
+
+            ClockOffsetResults results;
+            for (const auto& task : tasks)
+            {
+                auto& result = results[task._participant.getName()];
+                if (!task._error.empty())
+                {
+                    result._error = task._error;
+                    FEP3_SYSTEM_LOG(_logger, LoggerSeverity::warning, task._participant.getName(), _system_name,
+                        "the clock offset could not be measured: " + task._error);
+                    continue;
+                }
+                result._samples = task._estimator.getSampleCount();
+                result._round_trip_time = task._estimator.getRoundTripTime();
+                if (&task != &*reference)
+                {
+                    result._offset = task._estimator.getOffset() - reference->_estimator.getOffset();
+                    result._uncertainty = task._estimator.getUncertainty() + reference->_estimator.getUncertainty();
+                }
+            }
+            return results;
+        }
+
+        std::map<std::string, std::unique_ptr<IProperties>> getTimingProperties() const
+        {
+            std::map<std::string, std::unique_ptr<IProperties>> timing_properties;
+            std::map<std::string, IProperties*> destinations;
+            for (const ParticipantProxy& participant : _participants)
+            {
+                auto iterator_success = timing_properties.emplace(participant.getName(),
+                    std::unique_ptr<IProperties>(new base::Properties<IProperties>()));
+                if (!iterator_success.second)
+                {
+                    FEP3_SYSTEM_LOG_AND_THROW(_logger, LoggerSeverity::fatal, "", _system_name,
+                        "Multiple Participants with the name " + participant.getName() + " found");
+                }
+                destinations.emplace(participant.getName(), iterator_success.first->second.get());
+            }
+
+            // every participant writes to its own properties only
+            const auto results = accessPropertiesConcurrently(destinations,
+                [](fep3::rpc::IRPCConfiguration& config, IProperties* const& destination, PropertyAccessResult&)
+                {
+                    readTimingProperties(config, *destination);
+                });
+            for (const auto& [participant_name, result] : results)
+            {
+                throwIfParticipantFailed(participant_name, result);
+            }
+            return timing_properties;
+        }
+
+        static void readTimingProperties(fep3::rpc::IRPCConfiguration& config_rpc_client, IProperties& participant_properties)
+        {
+            auto set_if_present = [&participant_properties](const fep3::arya::IProperties& properties, const std::string& config_name) {
+                auto value = properties.getProperty(config_name);
+                if (value.empty())
+                {
+                    return false;
+                }
+                return participant_properties.setProperty(config_name, value, properties.getPropertyType(config_name));
+            };
+
+            auto clockservice_props = config_rpc_client.getProperties(FEP3_CLOCK_SERVICE_CONFIG);
+            if (clockservice_props)
+            {
+                set_if_present(*clockservice_props, FEP3_MAIN_CLOCK_PROPERTY);
+            }
+            auto clocksync_props = config_rpc_client.getProperties(FEP3_CLOCKSYNC_SERVICE_CONFIG);
+            if (clocksync_props)
+            {
+                if (set_if_present(*clocksync_props, FEP3_TIMING_MASTER_PROPERTY))
+                {
+                    if (clockservice_props)
+                    {
+                        set_if_present(*clockservice_props, FEP3_CLOCK_SIM_TIME_TIME_FACTOR_PROPERTY);
+                        set_if_present(*clockservice_props, FEP3_CLOCK_SIM_TIME_STEP_SIZE_PROPERTY);
+                        set_if_present(*clockservice_props, FEP3_TIME_UPDATE_TIMEOUT_PROPERTY);
+                    }
+                    set_if_present(*clocksync_props, FEP3_SLAVE_SYNC_CYCLE_TIME_PROPERTY);
+                }
+
+            }
+            auto scheduler_props = config_rpc_client.getProperties(FEP3_SCHEDULER_SERVICE_CONFIG);
+            if (scheduler_props)
+            {
+                set_if_present(*scheduler_props, FEP3_SCHEDULER_PROPERTY);
+            }
+        }
+
+        // throws if the whole participant could not be accessed, failing single properties are ignored
+        void throwIfParticipantFailed(const std::string& participant_name, const PropertyAccessResult& result) const
+        {
+            auto participant_error = result._errors.find("");
+            if (participant_error != result._errors.end())
+            {
+                FEP3_SYSTEM_LOG_AND_THROW(_logger,
+                    LoggerSeverity::error,
+                    participant_name,
+                    _system_name,
+                    participant_error->second);
+            }
+        }
+
+        void setInitAndStartPolicy(ExecutionConfig execution_config)
+        {
+            if (execution_config._thread_count > 0)
+            {
+                _execution_config = execution_config;
+            }
+            else
+            {
+                throw std::runtime_error("thread count with value 0 is not valid");
+            }
+        }
+
+        ExecutionConfig getInitAndStartPolicy() const
+        {
+            return _execution_config;
+        }
+
+        std::chrono::milliseconds getHeartbeatInterval(const std::string& participant)
+        {
+            auto part = getParticipant(participant, false);
+            if (part)
+            {
+
+                auto http_server_rpc = part.getRPCComponentProxyByIID<fep3::rpc::IRPCHttpServer>();
                 try 
                 {
                     throwIfNotValid<fep3::rpc::IRPCHttpServer>(http_server_rpc);
@@ -1376,23 +2140,94 @@ namespace fep3
 
         std::map<std::string, ParticipantHealth> getParticipantsHealth()
         {
-            ParticipantHealthStateAggregator health_state_aggregator(_liveliness_timeout);
-            for (auto& participant : _participants)
+            return getParticipantsHealthSince(0).participants_health;
+        }
+
+        ParticipantsHealthChanges getParticipantsHealthSince(uint64_t since_version)
+        {
+            return getParticipantsHealthSince(since_version, _participants);
+        }
+
+        ParticipantsHealthChanges getParticipantsHealthSince(uint64_t since_version,
+            const std::vector<ParticipantProxy>& participants)
+        {
+            std::lock_guard<std::mutex> lock(_health_sync);
+            // a change of the running state gets a version like a change of the jobs health,
+            // see runningStateChanged, the first query counts as change
+            for (const auto& participant : participants)
             {
-                health_state_aggregator.setParticipantHealth(participant.getName(), std::move(participant.getParticipantHealth()));
+                auto& running_state_version = _running_state_versions[participant.getName()];
+                if (running_state_version == 0)
+                {
+                    running_state_version = nextHealthVersion();
+                }
             }
 
-            return health_state_aggregator.getParticipantsHealth(std::chrono::steady_clock::now());
+            // taken before the running states and the jobs health, so nothing published
+            // in the meantime is missed, at worst it is also part of the next result
+            ParticipantsHealthChanges changes;
+            changes.version = currentHealthVersion();
+            for (const auto& participant : participants)
+            {
+                auto health = participant.getParticipantHealthSince(since_version);
+                if (health.version > since_version || _running_state_versions[participant.getName()] > since_version)
+                {
+                    changes.participants_health.emplace(participant.getName(),
+                        ParticipantHealth{ _liveliness_tracker.getRunningState(participant.getName()),
+                            std::move(health.jobs_healthiness) });
+                }
+            }
+            return changes;
         }
 
         void setLivelinessTimeout(fep3::Timestamp liveliness_timeout)
         {
-            _liveliness_timeout = std::move(liveliness_timeout);
+            _liveliness_tracker.setLivelinessTimeout(liveliness_timeout);
         }
 
         fep3::Timestamp getLivelinessTimeout()
         {
-            return _liveliness_timeout;
+            return _liveliness_tracker.getLivelinessTimeout();
+        }
+
+        void setHealthHistoryCapacity(size_t capacity)
+        {
+            _health_history_capacity = capacity;
+            for (auto& participant : _participants)
+            {
+                participant.setHealthHistoryCapacity(capacity);
+            }
+        }
+
+        size_t getHealthHistoryCapacity() const
+        {
+            return _health_history_capacity;
+        }
+
+        SimulationProgress getSimulationProgress() const
+        {
+            // the participant health listeners of this system update the monitor
+            return _simulation_progress_monitor->getProgress();
+        }
+
+        void registerHealthMonitoring(IHealthMonitor* health_monitor)
+        {
+            _health_notifier.registerMonitor(health_monitor);
+        }
+
+        void unregisterHealthMonitoring(IHealthMonitor* health_monitor)
+        {
+            _health_notifier.unregisterMonitor(health_monitor);
+        }
+
+        void setHealthMonitoringBatchInterval(std::chrono::milliseconds batch_interval)
+        {
+            _health_notifier.setBatchInterval(batch_interval);
+        }
+
+        std::chrono::milliseconds getHealthMonitoringBatchInterval() const
+        {
+            return _health_notifier.getBatchInterval();
         }
 
         void setHealthListenerRunningStatus(bool running)
@@ -1403,6 +2238,32 @@ namespace fep3
             }
         }
 
+        void preloadRPCComponentCatalogs() const
+        {
+            boost::asio::thread_pool pool(pool_size_for_parallel_ops);
+            for (const auto& participant : _participants)
+            {
+                boost::asio::post(pool,
+                    [&]()
+                    {
+                        try
+                        {
+                            participant.preloadRPCComponentCatalog();
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            // the catalog is fetched again on the first lookup, so this is not fatal
+                            FEP3_SYSTEM_LOG(_logger,
+                                LoggerSeverity::warning,
+                                participant.getName(),
+                                _system_name,
+                                std::string("Could not preload the rpc component catalog: ") + ex.what());
+                        }
+                    });
+            }
+            pool.join();
+        }
+
         std::pair<bool, bool> getHealthListenerRunningStatus() const
         {
             std::vector<bool> participant_health_listener_running(_participants.size());
@@ -1425,6 +2286,8 @@ namespace fep3
             }
         }
 
+        /// shared with the health listeners of the participants of this system only
+        std::shared_ptr<SimulationProgressMonitor> _simulation_progress_monitor = std::make_shared<SimulationProgressMonitor>();
         std::vector<ParticipantProxy> _participants;
         std::vector<std::string> _last_transition_failed_participants;
         std::shared_ptr<SystemLogger> _logger = std::make_shared<SystemLogger>();
@@ -1432,7 +2295,35 @@ namespace fep3
         std::string _system_discovery_url;
         ServiceBusWrapper _service_bus_wrapper;
         ::ExecutionConfig _execution_config;
-        fep3::Timestamp _liveliness_timeout = std::chrono::nanoseconds(std::chrono::seconds(20));
+        // thread safe and updated by const writes, hence mutable
+        mutable PropertyMirror _property_mirror;
+
+        /// health version of the last running state change by participant, 0 if never queried
+        std::map<std::string, uint64_t> _running_state_versions;
+        /// the participants the health notifier reports on, see @ref participantsChanged
+        std::shared_ptr<const std::vector<ParticipantProxy>> _health_notifier_participants
+            = std::make_shared<const std::vector<ParticipantProxy>>();
+        /// guards the running state versions and the participants of the health notifier
+        std::mutex _health_sync;
+        std::shared_ptr<ServiceUpdateDispatcher> _service_update_dispatcher;
+        /// the participants registered at the liveliness tracker
+        std::set<std::string> _tracked_participants;
+        size_t _health_history_capacity = 0;
+        LivelinessTracker _liveliness_tracker{ std::chrono::seconds(20),
+            [this](const std::string& participant_name, ParticipantRunningState)
+            {
+                runningStateChanged(participant_name);
+            } };
+        // declared last, so its thread is stopped before anything it uses is destroyed
+        HealthNotifier _health_notifier{ [this](uint64_t since_version)
+            {
+                std::shared_ptr<const std::vector<ParticipantProxy>> participants;
+                {
+                    std::lock_guard<std::mutex> lock(_health_sync);
+                    participants = _health_notifier_participants;
+                }
+                return getParticipantsHealthSince(since_version, *participants);
+            } };
     };
 
     System::System() : _impl(new Implementation(""))
@@ -1619,6 +2510,57 @@ namespace fep3
         return _impl->getParticipantProperty(participant_name, property_path);
     }
 
+    PropertyAccessResults System::setParticipantProperties(const ParticipantPropertyValues& property_values) const
+    {
+        return _impl->setParticipantProperties(property_values);
+    }
+
+    PropertyAccessResults System::setPropertiesOfAllParticipants(const PropertyValues& property_values) const
+    {
+        return _impl->setParticipantProperties(_impl->toAllParticipants(property_values));
+    }
+
+    ConfigurationApplyResults System::applyDesiredConfiguration(const ParticipantPropertyValues& desired_values) const
+    {
+        return _impl->applyDesiredConfiguration(desired_values);
+    }
+
+    PropertyAccessResults System::saveConfiguration(const std::string& file_path) const
+    {
+        return _impl->saveConfiguration(file_path);
+    }
+
+    ConfigurationApplyResults System::restoreConfiguration(const std::string& file_path)
+    {
+        return _impl->restoreConfiguration(file_path);
+    }
+
+    PropertyAccessResults System::refreshPropertyMirror() const
+    {
+        return _impl->refreshPropertyMirror();
+    }
+
+    ParticipantPropertyValues System::queryMirroredProperties(const std::string& path_pattern) const
+    {
+        return _impl->queryMirroredProperties(path_pattern);
+    }
+
+    std::vector<std::string> System::findParticipantsByMirroredProperty(const std::string& property_path,
+        const std::string& property_value) const
+    {
+        return _impl->findParticipantsByMirroredProperty(property_path, property_value);
+    }
+
+    PropertyAccessResults System::getParticipantProperties(const ParticipantPropertyPaths& property_paths) const
+    {
+        return _impl->getParticipantProperties(property_paths);
+    }
+
+    PropertyAccessResults System::getPropertiesOfAllParticipants(const std::vector<std::string>& property_paths) const
+    {
+        return _impl->getParticipantProperties(_impl->toAllParticipants(property_paths));
+    }
+
     SystemAggregatedState System::getParticipantState(const std::string& participant_name) const
     {
         return _impl->getParticipantState(participant_name);
@@ -1636,17 +2578,47 @@ namespace fep3
 
     void System::registerMonitoring(IEventMonitor& pEventListener)
     {
-        _impl->registerMonitoring(&pEventListener);
+        _impl->registerMonitoring(pEventListener, {});
+    }
+
+    void System::registerMonitoring(IEventMonitor& event_listener, const EventMonitorFilter& filter)
+    {
+        _impl->registerMonitoring(event_listener, filter);
     }
 
-    void System::unregisterMonitoring(IEventMonitor&)
+    void System::unregisterMonitoring(IEventMonitor& event_listener)
     {
-        _impl->releaseMonitoring();
+        _impl->unregisterMonitoring(event_listener);
     }
 
     void System::setSeverityLevel(LoggerSeverity severity_level)
     {
-        _impl->setSeverityLevel(severity_level);
+        _impl->setSeverityLevel(severity_level, false);
+    }
+
+    void System::setSeverityLevel(LoggerSeverity severity_level, bool apply_to_participants)
+    {
+        _impl->setSeverityLevel(severity_level, apply_to_participants);
+    }
+
+    LoggerSeverity System::getSeverityLevel() const
+    {
+        return _impl->getSeverityLevel();
+    }
+
+    void System::setAsyncLogging(const AsyncLoggingConfig& config)
+    {
+        _impl->setAsyncLogging(config);
+    }
+
+    AsyncLoggingConfig System::getAsyncLogging() const
+    {
+        return _impl->getAsyncLogging();
+    }
+
+    LoggingMetrics System::getLoggingMetrics() const
+    {
+        return _impl->getLoggingMetrics();
     }
 
     void System::configureTiming(const std::string& master_clock_name, const std::string& slave_clock_name,
@@ -1662,6 +2634,11 @@ namespace fep3
         return _impl->getCurrentTimingMasters();
     }
 
+    ClockOffsetResults System::measureClockOffsets(uint32_t rounds, const std::string& reference_participant) const
+    {
+        return _impl->measureClockOffsets(rounds, reference_participant);
+    }
+
     std::map<std::string, std::unique_ptr<IProperties>> System::getTimingProperties() const
     {
         return _impl->getTimingProperties();
@@ -1719,6 +2696,58 @@ namespace fep3
         return _impl->getParticipantsHealth();
     }
 
+    ParticipantsHealthChanges System::getParticipantsHealthSince(uint64_t version)
+    {
+        return _impl->getParticipantsHealthSince(version);
+    }
+
+    void System::setHealthHistoryCapacity(size_t capacity)
+    {
+        _impl->setHealthHistoryCapacity(capacity);
+    }
+
+    size_t System::getHealthHistoryCapacity() const
+    {
+        return _impl->getHealthHistoryCapacity();
+    }
+
+    std::vector<ParticipantHealthSample> System::getParticipantHealthHistory(const std::string& participant_name,
+        std::chrono::nanoseconds window) const
+    {
+        return _impl->getParticipant(participant_name, true).getHealthHistory(window);
+    }
+
+    ParticipantHealthRates System::getParticipantHealthRates(const std::string& participant_name,
+        std::chrono::nanoseconds window) const
+    {
+        return _impl->getParticipant(participant_name, true).getHealthRates(window);
+    }
+
+    SimulationProgress System::getSimulationProgress() const
+    {
+        return _impl->getSimulationProgress();
+    }
+
+    void System::registerHealthMonitoring(IHealthMonitor& health_monitor)
+    {
+        _impl->registerHealthMonitoring(&health_monitor);
+    }
+
+    void System::unregisterHealthMonitoring(IHealthMonitor& health_monitor)
+    {
+        _impl->unregisterHealthMonitoring(&health_monitor);
+    }
+
+    void System::setHealthMonitoringBatchInterval(std::chrono::milliseconds batch_interval)
+    {
+        _impl->setHealthMonitoringBatchInterval(batch_interval);
+    }
+
+    std::chrono::milliseconds System::getHealthMonitoringBatchInterval() const
+    {
+        return _impl->getHealthMonitoringBatchInterval();
+    }
+
     void System::setLivelinessTimeout(std::chrono::nanoseconds liveliness_timeout)
     {
         _impl->setLivelinessTimeout(std::move(liveliness_timeout));
@@ -1734,11 +2763,31 @@ namespace fep3
         _impl->setHealthListenerRunningStatus(running);
     }
 
+    void System::preloadRPCComponentCatalogs() const
+    {
+        _impl->preloadRPCComponentCatalogs();
+    }
+
     std::pair<bool, bool> System::getHealthListenerRunningStatus() const
     {
         return _impl->getHealthListenerRunningStatus();
     }
 
+    void System::setHealthFetchRateLimit(uint32_t requests_per_second)
+    {
+        fep3::setHealthFetchRateLimit(requests_per_second);
+    }
+
+    uint32_t System::getHealthFetchRateLimit() const
+    {
+        return fep3::getHealthFetchRateLimit();
+    }
+
+    HealthFetchMetrics System::getHealthFetchMetrics() const
+    {
+        return fep3::getHealthFetchMetrics();
+    }
+
     void System::setHeartbeatInterval(const std::vector<std::string>& participants, const std::chrono::milliseconds interval_ms)
     {
         _impl->setHeartbeatInterval(participants, interval_ms);
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+
+#include <fep_system/log_archive.h>
+#include "log_archive_query.h"
+#include "log_archive_writer.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace fep3
+{
+
+struct LogArchive::Implementation
+{
+    explicit Implementation(const LogArchiveConfig& config) : _writer(config)
+    {
+    }
+
+    /// a monitor registered at several systems is called concurrently
+    std::mutex _sync;
+    LogArchiveWriter _writer;
+    std::atomic<uint64_t> _written_count{ 0 };
+    std::atomic<uint64_t> _dropped_count{ 0 };
+};
+
+LogArchive::LogArchive(const LogArchiveConfig& config) : _impl(new Implementation(config))
+{
+}
+
+LogArchive::~LogArchive()
+{
+}
+
+void LogArchive::onLogRecord(const LogRecord& record)
+{
+    bool appended = false;
+    try
+    {
+        std::lock_guard<std::mutex> lock(_impl->_sync);
+        appended = _impl->_writer.append(record);
+    }
+    catch (const std::exception&)
+    {
+        // the logging must not fail because of the archive
+    }
+    ++(appended ? _impl->_written_count : _impl->_dropped_count);
+}
+
+void LogArchive::flush()
+{
+    std::lock_guard<std::mutex> lock(_impl->_sync);
+    _impl->_writer.flush();
+}
+
+uint64_t LogArchive::getWrittenCount() const
+{
+    return _impl->_written_count;
+}
+
+uint64_t LogArchive::getDroppedCount() const
+{
+    return _impl->_dropped_count;
+}
+
+LogArchiveReader::LogArchiveReader(const std::string& directory) : _directory(directory)
+{
+}
+
+LogArchiveReader::~LogArchiveReader()
+{
+}
+
+uint64_t LogArchiveReader::query(const LogArchiveQuery& query,
+    const std::function<bool(const LogArchiveEntry&)>& callback) const
+{
+    return queryLogArchive(_directory, query, callback);
+}
+
+std::vector<LogArchiveEntry> LogArchiveReader::query(const LogArchiveQuery& query) const
+{
+    std::vector<LogArchiveEntry> entries;
+    queryLogArchive(_directory, query, [&entries](const LogArchiveEntry& entry) {
+        entries.push_back(entry);
+        return true;
+    });
+    return entries;
+}
+
+} // namespace fep3
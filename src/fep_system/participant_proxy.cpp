@@ -34,13 +34,31 @@ ParticipantProxy::ParticipantProxy(const std::string& participant_name,
     const std::string& system_discovery_url,
     std::shared_ptr<ISystemLogger> logger,
     std::chrono::milliseconds default_timeout)
+    : ParticipantProxy(participant_name,
+        participant_url,
+        system_name,
+        system_discovery_url,
+        logger,
+        default_timeout,
+        std::make_shared<SimulationProgressMonitor>())
+{
+}
+
+ParticipantProxy::ParticipantProxy(const std::string& participant_name,
+    const std::string& participant_url,
+    const std::string& system_name,
+    const std::string& system_discovery_url,
+    std::shared_ptr<ISystemLogger> logger,
+    std::chrono::milliseconds default_timeout,
+    std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor)
 {
     _impl.reset(new Implementation(participant_name,
                                    participant_url,
                                    system_name,
                                    system_discovery_url,
                                    logger,
-                                   default_timeout));
+                                   default_timeout,
+                                   std::move(simulation_progress_monitor)));
 }
 ParticipantProxy::ParticipantProxy(ParticipantProxy&& other)
 {
@@ -125,6 +143,11 @@ bool ParticipantProxy::getRPCComponentProxyByIID(const std::string& component_ii
         proxy_ptr);
 }
 
+void ParticipantProxy::preloadRPCComponentCatalog() const
+{
+    _impl->preloadRPCComponentCatalog();
+}
+
 void ParticipantProxy::deregisterLogging()
 {
     _impl->deregisterLogging();
@@ -140,6 +163,26 @@ ParticipantHealthUpdate ParticipantProxy::getParticipantHealth() const
     return _impl->getParticipantHealth();
 }
 
+ParticipantHealthUpdate ParticipantProxy::getParticipantHealthSince(uint64_t version) const
+{
+    return _impl->getParticipantHealthSince(version);
+}
+
+void ParticipantProxy::setHealthHistoryCapacity(size_t capacity)
+{
+    _impl->setHealthHistoryCapacity(capacity);
+}
+
+std::vector<ParticipantHealthSample> ParticipantProxy::getHealthHistory(std::chrono::nanoseconds window) const
+{
+    return _impl->getHealthHistory(window);
+}
+
+ParticipantHealthRates ParticipantProxy::getHealthRates(std::chrono::nanoseconds window) const
+{
+    return _impl->getHealthRates(window);
+}
+
 void ParticipantProxy::setHealthListenerRunningStatus(bool running)
 {
     return _impl->setHealthListenerRunningStatus(running);
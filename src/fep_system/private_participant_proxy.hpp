@@ -22,6 +22,9 @@ You may add additional accurate notices of copyright ownership.
 #include <string>
 #include "system_logger_intf.h"
 #include "participant_health_listener.h"
+#include "simulation_progress_monitor.h"
+#include "service_update_dispatcher.h"
+#include "rpc_component_catalog_cache.h"
 
 #include "rpc_services/participant_info_proxy.hpp"
 #include "rpc_services/participant_statemachine_proxy.hpp"
@@ -34,10 +37,17 @@ You may add additional accurate notices of copyright ownership.
 #include "rpc_services/rpc_passthrough.hpp"
 #include "service_bus_wrapper.h"
 #include <math.h>
+#include <atomic>
+#include <algorithm>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/post.hpp>
 
 namespace fep3
 {
 
+/// maximum number of concurrent requests while fetching the rpc component catalog of one participant
+constexpr size_t catalog_fetch_pool_size = 4;
+
 struct ParticipantProxy::Implementation
 {
 public:
@@ -98,50 +108,45 @@ public:
         RPCComponent<T> _value;
     };
 
-    class InfoCache
+    /**
+     * @brief Invalidates the rpc component catalog whenever the participant disappears
+     * from the service bus or shows up at a different url (i.e. it was restarted).
+     */
+    class ServiceUpdateListener : public fep3::IServiceBus::IServiceUpdateEventSink
     {
     public:
-        std::vector<std::string> getComponentsWhichSupports(
-            RPCComponent<ConnectParticipantInfo>& info,
-            const std::string& iid,
-            ConnectStateMachine::State state_current)
-        {
-            std::lock_guard<std::recursive_mutex> lock(_sync);
-            auto it = _found_components_byiid.find(iid);
-            if (it != _found_components_byiid.end()
-                && state_current == _last_state)
+        ServiceUpdateListener(const std::string& participant_name,
+            const std::string& system_name,
+            std::function<void()> invalidator) :
+            _participant_name(participant_name),
+            _system_name(system_name),
+            _invalidator(std::move(invalidator))
+        {
+        }
+
+        void updateEvent(const fep3::IServiceBus::ServiceUpdateEvent& service_update_event) override
+        {
+            if ((_participant_name != service_update_event.service_name) ||
+                (_system_name != service_update_event.system_name))
             {
-                return it->second;
+                return;
             }
-            else
+
+            std::lock_guard<std::mutex> lock(_sync);
+            if (service_update_event.event_type == fep3::IServiceBus::ServiceUpdateEventType::notify_byebye
+                || service_update_event.host_url != _last_host_url)
             {
-                _found_components_byiid.clear();
-                auto found_objects = info->getRPCComponents();
-                for (const auto& current_object : found_objects)
-                {
-                    std::vector<std::string> found_interfaces;
-                    found_interfaces = info->getRPCComponentIIDs(current_object);
-                    for (const auto& current_iid : found_interfaces)
-                    {
-                        _found_components_byiid[current_iid].push_back(current_object);
-                    }
-                }
-                _last_state = state_current;
-                return _found_components_byiid[iid];
+                _last_host_url = service_update_event.host_url;
+                _invalidator();
             }
         }
 
-        void reset()
-        {
-            std::lock_guard<std::recursive_mutex> lock(_sync);
-            _found_components_byiid.clear();
-            _last_state = ConnectStateMachine::State::undefined;
-        }
-
     private:
-        std::map<std::string, std::vector<std::string>> _found_components_byiid;
-        std::recursive_mutex _sync;
-        ConnectStateMachine::State _last_state{ ConnectStateMachine::State::undefined};
+        const std::string _participant_name;
+        const std::string _system_name;
+        std::function<void()> _invalidator;
+        std::string _last_host_url;
+        std::mutex _sync;
     };
 
     Implementation(const std::string& participant_name,
@@ -149,7 +154,8 @@ public:
         const std::string& system_name,
         const std::string& system_discovery_url,
         std::shared_ptr<ISystemLogger> logger,
-        std::chrono::milliseconds default_timeout) :
+        std::chrono::milliseconds default_timeout,
+        std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor) :
         _participant_name(participant_name),
         _participant_url(participant_url),
         _logger(logger),
@@ -173,7 +179,10 @@ public:
             throw std::runtime_error(std::string("While contructing ") + participant_name + " at " + participant_url
                 + "no system connection to " + system_name + " at " + system_discovery_url +" possible");
         }
-        initHealthListener(system_name);
+        _system_name = system_name;
+        _service_update_dispatcher = getServiceUpdateDispatcher(_system_access);
+        initHealthListener(system_name, std::move(simulation_progress_monitor));
+        initServiceUpdateListener(system_name);
 
         _info.getValue();
         //only if info hasValue ... then it makes sense to connect to the others
@@ -207,9 +216,10 @@ public:
 
     virtual ~Implementation()
     {
+        _service_update_dispatcher->deregisterSink(_system_name, _participant_name, _service_update_listener.get());
         if (_health_listener_running)
         {
-            _system_access->deregisterUpdateEventSink(_participant_health_Listener.get());
+            _service_update_dispatcher->deregisterSink(_system_name, _participant_name, _participant_health_Listener.get());
         }
         deregisterLogging();
     }
@@ -278,7 +288,8 @@ public:
         {
             std::shared_ptr<rpc::arya::IRPCServiceClient> part_object = std::make_shared<rpc::arya::ParticipantStateMachineProxy>(
                 component_name,
-                requester);
+                requester,
+                _info_cache.getInvalidator());
             return proxy_ptr.reset(part_object);
         }
         else if (component_iid == fep3::rpc::getRPCIID<ConnectLoggingSinkService>())
@@ -345,7 +356,8 @@ public:
         {
             std::shared_ptr<rpc::arya::IRPCServiceClient> part_object = std::make_shared<rpc::arya::ParticipantStateMachineProxy>(
                 component_name,
-                requester);
+                requester,
+                _info_cache.getInvalidator());
             return proxy_ptr.reset(part_object);
         }
         else if (component_iid == fep3::rpc::getRPCIID<rpc::arya::IRPCClockService>())
@@ -384,7 +396,12 @@ public:
                 _participant_name,
                 component_name,
                 requester,
-                *_logger);
+                *_logger,
+                _property_cache,
+                [system_access = _system_access, participant_name = _participant_name]()
+                {
+                    return system_access->getRequester(participant_name);
+                });
             return proxy_ptr.reset(part_object);
         }
         else if (component_iid == fep3::rpc::getRPCIID<rpc::catelyn::IRPCHealthService>())
@@ -461,8 +478,20 @@ public:
 
     std::vector<std::string> getComponentNameWhichSupports(std::string iid) const
     {
-        std::vector<std::string> found_objects;
-        std::vector<std::string> found_objects_which_supports;
+        RPCComponent<ConnectParticipantInfo> info = getReachableInfo();
+        return _info_cache.getComponentsWhichSupports(
+            [&](RPCComponentCatalogCache::Catalog& catalog) { return fetchRPCComponentCatalog(info, catalog); }, iid);
+    }
+
+    void preloadRPCComponentCatalog() const
+    {
+        RPCComponent<ConnectParticipantInfo> info = getReachableInfo();
+        _info_cache.refreshIfOutdated(
+            [&](RPCComponentCatalogCache::Catalog& catalog) { return fetchRPCComponentCatalog(info, catalog); });
+    }
+
+    RPCComponent<ConnectParticipantInfo> getReachableInfo() const
+    {
         RPCComponent<ConnectParticipantInfo> info = _info.getValue();
         if (!info)
         {
@@ -474,7 +503,71 @@ public:
                 err_message);
             throw std::runtime_error(err_message);
         }
-        return _info_cache.getComponentsWhichSupports(info, iid, getCurrentState());
+        return info;
+    }
+
+    /**
+     * @brief Fetches the rpc components and their iids of the participant.
+     * The iids of the components are requested concurrently, so a cache miss costs
+     * one round trip for the component list plus roughly one for all iid lists.
+     * The info proxy reports failed requests as empty lists. Every participant has components
+     * and every component supports an iid, so empty lists mark the catalog as incomplete.
+     *
+     * @return false if the catalog is incomplete, so it is not cached
+     */
+    bool fetchRPCComponentCatalog(RPCComponent<ConnectParticipantInfo>& info,
+        RPCComponentCatalogCache::Catalog& catalog) const
+    {
+        std::vector<std::string> found_objects;
+        for (const auto& current_object : info->getRPCComponents())
+        {
+            if (!current_object.empty())
+            {
+                found_objects.push_back(current_object);
+            }
+        }
+        if (found_objects.empty())
+        {
+            return false;
+        }
+
+        std::vector<std::vector<std::string>> found_interfaces(found_objects.size());
+        {
+            boost::asio::thread_pool pool(std::max<size_t>(1, std::min<size_t>(found_objects.size(), catalog_fetch_pool_size)));
+            for (size_t index = 0; index < found_objects.size(); ++index)
+            {
+                boost::asio::post(pool,
+                    [&, index]()
+                    {
+                        //each request gets its own requester, requesters are not shared between threads
+                        auto requester = _system_access->getRequester(_participant_name);
+                        if (requester)
+                        {
+                            rpc::arya::ParticipantInfoProxy info_proxy(ConnectParticipantInfo::getRPCDefaultName(), requester);
+                            // each thread touches a different vector index
+                            found_interfaces[index] = info_proxy.getRPCComponentIIDs(found_objects[index]);
+                        }
+                    });
+            }
+            pool.join();
+        }
+
+        bool complete = true;
+        for (size_t index = 0; index < found_objects.size(); ++index)
+        {
+            bool supports_any = false;
+            for (const auto& current_iid : found_interfaces[index])
+            {
+                if (!current_iid.empty())
+                {
+                    catalog[current_iid].push_back(found_objects[index]);
+                    supports_any = true;
+                }
+            }
+            //no requester or the request failed
+            complete = complete && supports_any;
+        }
+        return complete;
     }
 
     ConnectStateMachine::State getCurrentState() const
@@ -524,22 +617,49 @@ public:
         }
     }
 
+    ParticipantHealthUpdate getParticipantHealthSince(uint64_t version) const
+    {
+        if (_health_listener_running)
+        {
+            return _participant_health_Listener->getParticipantHealthSince(version);
+        }
+        else
+        {
+            throw std::runtime_error("You cannot get participant health with a deactivated health listener");
+        }
+    }
+
+    void setHealthHistoryCapacity(size_t capacity)
+    {
+        _participant_health_Listener->getHealthHistory().setCapacity(capacity);
+    }
+
+    std::vector<ParticipantHealthSample> getHealthHistory(std::chrono::nanoseconds window) const
+    {
+        return _participant_health_Listener->getHealthHistory().getSamples(std::chrono::steady_clock::now() - window);
+    }
+
+    ParticipantHealthRates getHealthRates(std::chrono::nanoseconds window) const
+    {
+        return _participant_health_Listener->getHealthHistory().getRates(std::chrono::steady_clock::now() - window);
+    }
+
     void setHealthListenerRunningStatus(bool running)
     {
-        if (_health_listener_running == running)
+        // exchanged, so concurrent calls with the same status do not register twice
+        if (_health_listener_running.exchange(running) == running)
         {
             return;
         }
         else
         {
-            _health_listener_running = running;
             if (running)
             {
-                _system_access->registerUpdateEventSink(_participant_health_Listener.get());
+                _service_update_dispatcher->registerSink(_system_name, _participant_name, _participant_health_Listener.get());
             }
             else
             {
-                _system_access->deregisterUpdateEventSink(_participant_health_Listener.get());
+                _service_update_dispatcher->deregisterSink(_system_name, _participant_name, _participant_health_Listener.get());
             }
         }
     }
@@ -549,7 +669,7 @@ public:
         return _health_listener_running;
     }
 private:
-    void initHealthListener(const std::string& system_name)
+    void initHealthListener(const std::string& system_name, std::shared_ptr<SimulationProgressMonitor> simulation_progress_monitor)
     {
         _participant_health_Listener = std::make_unique<ParticipantHealthListener>(&(_health.getValue().getInterface()),
             _participant_name,
@@ -560,16 +680,29 @@ private:
                 {
                     _logger->log(severity, _participant_name, "", message);
                 }
-            });
+            },
+            getHealthFetchQueue(),
+            std::move(simulation_progress_monitor));
+
+        _service_update_dispatcher->registerSink(system_name, _participant_name, _participant_health_Listener.get());
+    }
+
+    void initServiceUpdateListener(const std::string& system_name)
+    {
+        _service_update_listener = std::make_unique<ServiceUpdateListener>(_participant_name,
+            system_name,
+            _info_cache.getInvalidator());
 
-        _system_access->registerUpdateEventSink(_participant_health_Listener.get());
+        _service_update_dispatcher->registerSink(system_name, _participant_name, _service_update_listener.get());
     }
 
     std::shared_ptr<ISystemLogger> _logger;
     std::string _participant_name;
     std::string _participant_url;
 
-    mutable InfoCache _info_cache;
+    mutable RPCComponentCatalogCache _info_cache;
+    /// shared by all configuration proxies of this participant
+    std::shared_ptr<rpc::arya::PropertyCache> _property_cache = std::make_shared<rpc::arya::PropertyCache>(_info_cache.getGenerationSource());
     mutable RPCComponentCache<ConnectParticipantInfo>    _info;
     mutable RPCComponentCache<ConnectStateMachine>       _state_machine;
     mutable RPCComponentCache<ConnectLoggingSinkService> _logging;
@@ -586,8 +719,13 @@ private:
     //we need to make sure the service bus connection lives as locg the system access is used
     ServiceBusWrapper _service_bus_wrapper;
     std::shared_ptr<fep3::IServiceBus::ISystemAccess> _system_access;
+    /// one per system access, forwards only the events of this participant
+    std::shared_ptr<ServiceUpdateDispatcher> _service_update_dispatcher;
+    std::string _system_name;
     std::unique_ptr<ParticipantHealthListener> _participant_health_Listener;
-    bool _health_listener_running;
+    std::unique_ptr<ServiceUpdateListener> _service_update_listener;
+    /// read by the health notifier thread
+    std::atomic<bool> _health_listener_running;
 };
 
 }
@@ -19,11 +19,27 @@ except ImportError:
 # class EventMonitor to use for further inheritance
 # to add an own function 'onLog' for using Event Monitor
 #    def onLog(self, log_time, severity_level, participant_name, logger_name, message):
+# an optional fep3_system.EventMonitorFilter restricts the log records passed to onLog
 class EventMonitor(fep3_system.IEventMonitor):
-    def __init__(self, system):
+    def __init__(self, system, event_filter=None):
         fep3_system.IEventMonitor.__init__(self)
         # register monitoring here to guarantee unregistering in destructor
-        system.registerMonitoring(self)
+        if event_filter is None:
+            system.registerMonitoring(self)
+        else:
+            system.registerMonitoring(self, event_filter)
         self._system = system
     def __del__(self):
         self._system.unregisterMonitoring(self)
+
+# class HealthMonitor to use for further inheritance
+# to add an own function 'onHealthChanged' for using Health Monitor
+#    def onHealthChanged(self, participants_health):
+class HealthMonitor(fep3_system.IHealthMonitor):
+    def __init__(self, system):
+        fep3_system.IHealthMonitor.__init__(self)
+        # register monitoring here to guarantee unregistering in destructor
+        system.registerHealthMonitoring(self)
+        self._system = system
+    def __del__(self):
+        self._system.unregisterHealthMonitoring(self)
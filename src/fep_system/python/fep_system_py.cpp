@@ -55,6 +55,24 @@ public:
     }
 };
 
+// helper class to define new types of IHealthMonitor within python
+class PyHealthMonitor : public IHealthMonitor {
+public:
+    /* Inherit the constructor */
+    using IHealthMonitor::IHealthMonitor;
+
+    /* Trampoline (need one for each virtual function) */
+    void onHealthChanged(const std::map<std::string, ParticipantHealth>& participants_health) override {
+        py::gil_scoped_acquire acquire;
+        PYBIND11_OVERRIDE_PURE(
+            void,           /* Return type */
+            IHealthMonitor, /* Parent class */
+            onHealthChanged,/* Name of function in C++ (must match Python name) */
+            participants_health    /* Argument(s) */
+        );
+    }
+};
+
 // helper class to define an instance of rpc::RPCClient<rpc::experimental::IRPCPassthrough>
 class PyRPCComponentPtr : public IRPCComponentPtr {
 public:
@@ -91,6 +109,8 @@ PYBIND11_MODULE(fep3_system, m) {
     // class to get Configuration (return type for RPCComponent<rpc::IRPCConfiguration>::getInterface -> rpc::arya::ConfigurationProxy)
     py::class_<rpc::IRPCConfiguration, std::unique_ptr<rpc::IRPCConfiguration, py::nodelete>>(m, "IRPCConfiguration")
         .def("getProperties", py::overload_cast<const std::string&>(&rpc::arya::IRPCConfiguration::getProperties),
+            py::arg("property_path"), py::call_guard<py::gil_scoped_release>())
+        .def("getPropertyTree", &rpc::arya::IRPCConfiguration::getPropertyTree,
             py::arg("property_path"), py::call_guard<py::gil_scoped_release>());
 
     // class IRPCPassthrough and its member functions
@@ -137,6 +157,27 @@ PYBIND11_MODULE(fep3_system, m) {
         .value("offline", ParticipantRunningState::offline)
         .value("online", ParticipantRunningState::online);
 
+    py::class_<PropertyAccessResult>(m, "PropertyAccessResult")                                     // for System::get/setParticipantProperties
+        .def_readonly("values", &PropertyAccessResult::_values)
+        .def_readonly("errors", &PropertyAccessResult::_errors);
+    py::class_<ConfigurationApplyResult>(m, "ConfigurationApplyResult")                             // for System::applyDesiredConfiguration
+        .def_readonly("written", &ConfigurationApplyResult::_written)
+        .def_readonly("skipped", &ConfigurationApplyResult::_skipped)
+        .def_readonly("errors", &ConfigurationApplyResult::_errors);
+    py::class_<ClockOffsetResult>(m, "ClockOffsetResult")                                           // for System::measureClockOffsets
+        .def_readonly("offset", &ClockOffsetResult::_offset)
+        .def_readonly("uncertainty", &ClockOffsetResult::_uncertainty)
+        .def_readonly("round_trip_time", &ClockOffsetResult::_round_trip_time)
+        .def_readonly("samples", &ClockOffsetResult::_samples)
+        .def_readonly("error", &ClockOffsetResult::_error);
+    py::class_<HealthFetchMetrics>(m, "HealthFetchMetrics")                                         // for System::getHealthFetchMetrics
+        .def_readonly("requested", &HealthFetchMetrics::requested)
+        .def_readonly("coalesced", &HealthFetchMetrics::coalesced)
+        .def_readonly("fetched", &HealthFetchMetrics::fetched)
+        .def_readonly("failed", &HealthFetchMetrics::failed)
+        .def_readonly("dropped", &HealthFetchMetrics::dropped)
+        .def_readonly("pending", &HealthFetchMetrics::pending);
+
     py::class_<JobHealthiness::ExecuteResult>(m, "ExecuteResult")                                   // for last_error in ExecuteError
         .def_readwrite("error_code", &JobHealthiness::ExecuteResult::error_code)
         .def_readwrite("error_description", &JobHealthiness::ExecuteResult::error_description)
@@ -174,6 +215,33 @@ PYBIND11_MODULE(fep3_system, m) {
     py::class_<ParticipantHealth>(m, "ParticipantHealth")                           // for returnvalue of getParticipantsHealth
         .def_readwrite("running_state", &ParticipantHealth::running_state)
         .def_readonly("jobs_healthiness", &ParticipantHealth::jobs_healthiness);
+    py::class_<ParticipantsHealthChanges>(m, "ParticipantsHealthChanges")           // for returnvalue of getParticipantsHealthSince
+        .def_readonly("version", &ParticipantsHealthChanges::version)
+        .def_readonly("participants_health", &ParticipantsHealthChanges::participants_health);
+    py::class_<ParticipantHealthSample>(m, "ParticipantHealthSample")               // for returnvalue of getParticipantHealthHistory
+        .def_readonly("system_time", &ParticipantHealthSample::system_time)
+        .def_readonly("simulation_time", &ParticipantHealthSample::simulation_time)
+        .def_readonly("jobs_error_count", &ParticipantHealthSample::jobs_error_count);
+    py::class_<ParticipantHealthRates>(m, "ParticipantHealthRates")                 // for returnvalue of getParticipantHealthRates
+        .def_readonly("sample_count", &ParticipantHealthRates::sample_count)
+        .def_readonly("errors_per_second", &ParticipantHealthRates::errors_per_second)
+        .def_readonly("simulation_time_per_second", &ParticipantHealthRates::simulation_time_per_second)
+        .def_readonly("mean_heartbeat_interval", &ParticipantHealthRates::mean_heartbeat_interval)
+        .def_readonly("heartbeat_jitter", &ParticipantHealthRates::heartbeat_jitter);
+
+    py::class_<ParticipantSimulationProgress>(m, "ParticipantSimulationProgress")   // for returnvalue of getSimulationProgress
+        .def_readonly("simulation_time", &ParticipantSimulationProgress::simulation_time)
+        .def_readonly("real_time_factor", &ParticipantSimulationProgress::real_time_factor)
+        .def_readonly("lag", &ParticipantSimulationProgress::lag);
+
+    py::class_<SimulationProgress>(m, "SimulationProgress")                         // for returnvalue of getSimulationProgress
+        .def_readonly("participants", &SimulationProgress::participants)
+        .def_readonly("min_real_time_factor", &SimulationProgress::min_real_time_factor)
+        .def_readonly("max_real_time_factor", &SimulationProgress::max_real_time_factor)
+        .def_readonly("mean_real_time_factor", &SimulationProgress::mean_real_time_factor)
+        .def_readonly("min_lag", &SimulationProgress::min_lag)
+        .def_readonly("max_lag", &SimulationProgress::max_lag)
+        .def_readonly("mean_lag", &SimulationProgress::mean_lag);
     py::enum_<LoggerSeverity>(m, "LoggerSeverity")                                  // for function onLog in IEventMonitor
         .value("off", LoggerSeverity::off)
         .value("fatal", LoggerSeverity::fatal)
@@ -181,9 +249,56 @@ PYBIND11_MODULE(fep3_system, m) {
         .value("warning", LoggerSeverity::warning)
         .value("info", LoggerSeverity::info)
         .value("debug", LoggerSeverity::debug);
+    py::enum_<LogOverflowPolicy>(m, "LogOverflowPolicy")                            // for AsyncLoggingConfig
+        .value("drop_oldest", LogOverflowPolicy::drop_oldest)
+        .value("block", LogOverflowPolicy::block);
+    py::class_<AsyncLoggingConfig>(m, "AsyncLoggingConfig")                          // for System::setAsyncLogging
+        .def(py::init<>())
+        .def_readwrite("enabled", &AsyncLoggingConfig::_enabled)
+        .def_readwrite("queue_capacity", &AsyncLoggingConfig::_queue_capacity)
+        .def_readwrite("overflow_policy", &AsyncLoggingConfig::_overflow_policy);
+    py::class_<LoggingMetrics>(m, "LoggingMetrics")                                  // for returnvalue of getLoggingMetrics
+        .def_readonly("delivered", &LoggingMetrics::_delivered)
+        .def_readonly("dropped", &LoggingMetrics::_dropped)
+        .def_readonly("blocked", &LoggingMetrics::_blocked)
+        .def_readonly("queued", &LoggingMetrics::_queued);
+    py::class_<EventMonitorFilter>(m, "EventMonitorFilter")                          // for registerMonitoring
+        .def(py::init<>())
+        .def_readwrite("severity", &EventMonitorFilter::_severity)
+        .def_readwrite("participant_names", &EventMonitorFilter::_participant_names)
+        .def_readwrite("logger_name_prefix", &EventMonitorFilter::_logger_name_prefix);
     py::class_<IEventMonitor, PyEventMonitor>(m, "IEventMonitor")                   // for register- and unregisterMonitoring
         .def(py::init<>())
         .def("onLog", &IEventMonitor::onLog);
+    py::class_<LogArchiveConfig>(m, "LogArchiveConfig")                              // for LogArchive
+        .def(py::init<>())
+        .def_readwrite("directory", &LogArchiveConfig::_directory)
+        .def_readwrite("segment_size", &LogArchiveConfig::_segment_size)
+        .def_readwrite("max_segments", &LogArchiveConfig::_max_segments);
+    py::class_<LogArchive, IEventMonitor>(m, "LogArchive")                          // for register- and unregisterMonitoring
+        .def(py::init<const LogArchiveConfig&>(), py::arg("config"))
+        .def("flush", &LogArchive::flush)
+        .def("getWrittenCount", &LogArchive::getWrittenCount)
+        .def("getDroppedCount", &LogArchive::getDroppedCount);
+    py::class_<LogArchiveQuery>(m, "LogArchiveQuery")                                // for LogArchiveReader::query
+        .def(py::init<>())
+        .def_readwrite("begin", &LogArchiveQuery::_begin)
+        .def_readwrite("end", &LogArchiveQuery::_end)
+        .def_readwrite("severity", &LogArchiveQuery::_severity)
+        .def_readwrite("participant_names", &LogArchiveQuery::_participant_names);
+    py::class_<LogArchiveEntry>(m, "LogArchiveEntry")                                // for returnvalue of LogArchiveReader::query
+        .def_readonly("timestamp", &LogArchiveEntry::_timestamp)
+        .def_readonly("severity", &LogArchiveEntry::_severity)
+        .def_readonly("participant_name", &LogArchiveEntry::_participant_name)
+        .def_readonly("logger_name", &LogArchiveEntry::_logger_name)
+        .def_readonly("message", &LogArchiveEntry::_message);
+    py::class_<LogArchiveReader>(m, "LogArchiveReader")
+        .def(py::init<const std::string&>(), py::arg("directory"))
+        .def("query", py::overload_cast<const LogArchiveQuery&>(&LogArchiveReader::query, py::const_),
+            py::arg("query") = LogArchiveQuery(), py::call_guard<py::gil_scoped_release>());
+    py::class_<IHealthMonitor, PyHealthMonitor>(m, "IHealthMonitor")                // for register- and unregisterHealthMonitoring
+        .def(py::init<>())
+        .def("onHealthChanged", &IHealthMonitor::onHealthChanged);
 
     // class System and its member functions
     py::class_<System> (m, "System")
@@ -202,27 +317,80 @@ PYBIND11_MODULE(fep3_system, m) {
         py::arg("timeout_ms") = FEP_SYSTEM_DISCOVER_TIMEOUT, py::call_guard<py::gil_scoped_release>())
     .def("setParticipantProperty", &System::setParticipantProperty,
         py::arg("participant_name"), py::arg("property_path"), py::arg("property_value"), py::call_guard<py::gil_scoped_release>())
+    .def("setParticipantProperties", &System::setParticipantProperties,
+        py::arg("property_values"), py::call_guard<py::gil_scoped_release>())
+    .def("setPropertiesOfAllParticipants", &System::setPropertiesOfAllParticipants,
+        py::arg("property_values"), py::call_guard<py::gil_scoped_release>())
+    .def("getParticipantProperties", &System::getParticipantProperties,
+        py::arg("property_paths"), py::call_guard<py::gil_scoped_release>())
+    .def("getPropertiesOfAllParticipants", &System::getPropertiesOfAllParticipants,
+        py::arg("property_paths"), py::call_guard<py::gil_scoped_release>())
+    .def("applyDesiredConfiguration", &System::applyDesiredConfiguration,
+        py::arg("desired_values"), py::call_guard<py::gil_scoped_release>())
+    .def("saveConfiguration", &System::saveConfiguration,
+        py::arg("file_path"), py::call_guard<py::gil_scoped_release>())
+    .def("restoreConfiguration", &System::restoreConfiguration,
+        py::arg("file_path"), py::call_guard<py::gil_scoped_release>())
+    .def("refreshPropertyMirror", &System::refreshPropertyMirror, py::call_guard<py::gil_scoped_release>())
+    .def("queryMirroredProperties", &System::queryMirroredProperties,
+        py::arg("path_pattern"), py::call_guard<py::gil_scoped_release>())
+    .def("findParticipantsByMirroredProperty", &System::findParticipantsByMirroredProperty,
+        py::arg("property_path"), py::arg("property_value"), py::call_guard<py::gil_scoped_release>())
     .def("getParticipantsHealth", &System::getParticipantsHealth, py::call_guard<py::gil_scoped_release>())
+    .def("getParticipantsHealthSince", &System::getParticipantsHealthSince,
+        py::arg("version"), py::call_guard<py::gil_scoped_release>())
+    .def("registerHealthMonitoring", &System::registerHealthMonitoring,
+        py::arg("health_monitor"), py::call_guard<py::gil_scoped_release>())
+    .def("unregisterHealthMonitoring", &System::unregisterHealthMonitoring,
+        py::arg("health_monitor"), py::call_guard<py::gil_scoped_release>())
+    .def("setHealthMonitoringBatchInterval", &System::setHealthMonitoringBatchInterval,
+        py::arg("batch_interval_ms"))
+    .def("getHealthMonitoringBatchInterval", &System::getHealthMonitoringBatchInterval)
     .def("setLivelinessTimeout", &System::setLivelinessTimeout,
         py::arg("liveliness_timeout_ns"), py::call_guard<py::gil_scoped_release>())
     .def("getLivelinessTimeout", &System::getLivelinessTimeout)
     .def("setHealthListenerRunningStatus", &System::setHealthListenerRunningStatus,
         py::arg("running"), py::call_guard<py::gil_scoped_release>())
+    .def("setHealthFetchRateLimit", &System::setHealthFetchRateLimit,
+        py::arg("requests_per_second"))
+    .def("getHealthFetchRateLimit", &System::getHealthFetchRateLimit)
+    .def("getHealthFetchMetrics", &System::getHealthFetchMetrics)
     .def("getHealthListenerRunningStatus", &System::getHealthListenerRunningStatus)
+    .def("setHealthHistoryCapacity", &System::setHealthHistoryCapacity,
+        py::arg("capacity"))
+    .def("getHealthHistoryCapacity", &System::getHealthHistoryCapacity)
+    .def("getParticipantHealthHistory", &System::getParticipantHealthHistory,
+        py::arg("participant_name"), py::arg("window_ns"), py::call_guard<py::gil_scoped_release>())
+    .def("getParticipantHealthRates", &System::getParticipantHealthRates,
+        py::arg("participant_name"), py::arg("window_ns"), py::call_guard<py::gil_scoped_release>())
+    .def("getSimulationProgress", &System::getSimulationProgress)
+    .def("preloadRPCComponentCatalogs", &System::preloadRPCComponentCatalogs,
+        py::call_guard<py::gil_scoped_release>())
     .def("setHeartbeatInterval", &System::setHeartbeatInterval,
         py::arg("participants"), py::arg("interval_ms"), py::call_guard<py::gil_scoped_release>())
     .def("getHeartbeatInterval", &System::getHeartbeatInterval,
         py::arg("participants"), py::call_guard<py::gil_scoped_release>())
-    .def("registerMonitoring", &System::registerMonitoring,
+    .def("registerMonitoring", py::overload_cast<IEventMonitor&>(&System::registerMonitoring),
         py::arg("event_listener"), py::call_guard<py::gil_scoped_release>())
+    .def("registerMonitoring", py::overload_cast<IEventMonitor&, const EventMonitorFilter&>(&System::registerMonitoring),
+        py::arg("event_listener"), py::arg("filter"), py::call_guard<py::gil_scoped_release>())
     .def("unregisterMonitoring", &System::unregisterMonitoring,
         py::arg("event_listener"), py::call_guard<py::gil_scoped_release>())
+    .def("setSeverityLevel", py::overload_cast<LoggerSeverity, bool>(&System::setSeverityLevel),
+        py::arg("severity_level"), py::arg("apply_to_participants") = false, py::call_guard<py::gil_scoped_release>())
+    .def("getSeverityLevel", &System::getSeverityLevel)
+    .def("setAsyncLogging", &System::setAsyncLogging,
+        py::arg("config"), py::call_guard<py::gil_scoped_release>())
+    .def("getAsyncLogging", &System::getAsyncLogging)
+    .def("getLoggingMetrics", &System::getLoggingMetrics)
     .def("configureTiming3ClockSyncOnlyInterpolation", &System::configureTiming3ClockSyncOnlyInterpolation,
         py::arg("master_element_id"), py::arg("slave_sync_cycle_time_ms"), py::call_guard<py::gil_scoped_release>())
     .def("configureTiming3DiscreteSteps", &System::configureTiming3DiscreteSteps,
         py::arg("master_element_id"), py::arg("master_time_stepsize_ns"), py::arg("master_time_factor"), py::call_guard<py::gil_scoped_release>())
     .def("configureTiming3NoMaster", &System::configureTiming3NoMaster, py::call_guard<py::gil_scoped_release>())
     .def("getCurrentTimingMasters", &System::getCurrentTimingMasters, py::call_guard<py::gil_scoped_release>())
+    .def("measureClockOffsets", &System::measureClockOffsets,
+        py::arg("rounds") = 8, py::arg("reference_participant") = "", py::call_guard<py::gil_scoped_release>())
     .def("getSystemName", &System::getSystemName, py::call_guard<py::gil_scoped_release>());
 
     // public functions of module fep_system
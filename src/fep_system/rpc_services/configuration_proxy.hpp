@@ -20,7 +20,14 @@ You may add additional accurate notices of copyright ownership.
 
 #pragma once
 #include <string>
-#include <regex>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/post.hpp>
 
 //this will be installed !!
 #include "rpc_services/configuration/configuration_rpc_intf.h"
@@ -28,6 +35,7 @@ You may add additional accurate notices of copyright ownership.
 #include <fep3/base/properties/property_type.h>
 #include <fep3/base/properties/property_type_conversion.h>
 #include "system_logger_intf.h"
+#include "property_path.h"
 
 #include <a_util/strings.h>
 
@@ -62,6 +70,377 @@ using RPCConfigProxy = RPCServiceClientProxy< rpc_proxy_stub::RPCConfigurationSe
 using RPCConfigClient = RPCServiceClient< rpc_proxy_stub::RPCConfigurationServiceProxy,
     IRPCConfiguration>;
 
+/**
+ * @brief Client side cache of the property types of one participant
+ * and of the property nodes known to exist.
+ * Values are not cached, since the participant changes them without notifying anyone.
+ * The whole cache is dropped whenever the generation changes, which happens on our own
+ * state transitions and if the participant disappears or is restarted.
+ */
+class PropertyCache
+{
+public:
+    /// returns the current generation, 0 disables the cache
+    using GenerationSource = std::function<uint64_t()>;
+
+    explicit PropertyCache(GenerationSource generation_source = {}) :
+        _generation_source(std::move(generation_source))
+    {
+    }
+
+    bool findType(const std::string& path, std::string& type) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        if (!isValid())
+        {
+            return false;
+        }
+        auto it = _types.find(path);
+        if (it == _types.end())
+        {
+            return false;
+        }
+        type = it->second;
+        return true;
+    }
+
+    void storeType(const std::string& path, const std::string& type)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        if (isValid())
+        {
+            _types[path] = type;
+        }
+    }
+
+    void eraseType(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        _types.erase(path);
+    }
+
+    bool isKnownNode(const std::string& node_path) const
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return isValid() && (_known_nodes.count(node_path) != 0);
+    }
+
+    void addKnownNode(const std::string& node_path)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        if (isValid())
+        {
+            _known_nodes.insert(node_path);
+        }
+    }
+
+private:
+    /// drops all entries if the generation changed, must be called locked
+    bool isValid() const
+    {
+        const uint64_t generation = _generation_source ? _generation_source() : 0;
+        if (generation != _generation)
+        {
+            _types.clear();
+            _known_nodes.clear();
+            _generation = generation;
+        }
+        return _generation != 0;
+    }
+
+    GenerationSource _generation_source;
+    mutable std::mutex _sync;
+    mutable std::unordered_map<std::string, std::string> _types;
+    mutable std::unordered_set<std::string> _known_nodes;
+    mutable uint64_t _generation{ 0 };
+};
+
+/**
+ * @brief Reads many property nodes of one participant at once.
+ * The requests are sent as one JSON-RPC batch request if the participant accepts it,
+ * otherwise they are sent concurrently, each worker with its own requester.
+ */
+class PropertyTreeReader
+{
+public:
+    /// creates a requester which is used by one worker thread only
+    using RequesterFactory = std::function<std::shared_ptr<IRPCRequester>()>;
+
+    PropertyTreeReader(const std::string& component_name,
+        const std::shared_ptr<IRPCRequester>& rpc,
+        RequesterFactory requester_factory) :
+        _component_name(component_name),
+        _rpc(rpc),
+        _requester_factory(std::move(requester_factory))
+    {
+    }
+
+    /**
+     * @brief Copies the property nodes below @p node_path into @p properties.
+     * The names within @p properties are relative to @p node_path,
+     * nested nodes are separated by '/'.
+     *
+     * @param[in] node_path normalized path of the node, ending with '/'
+     * @param[out] properties destination of the types and values
+     * @param[in] recursive if false, only the direct children of the node are copied
+     * @throw std::runtime_error if a request fails
+     */
+    void readTree(const std::string& node_path, IProperties& properties, bool recursive) const
+    {
+        const auto root_names = call({ { Method::get_names, node_path } });
+        std::vector<std::string> level = childPaths("", root_names[0]);
+        while (!level.empty())
+        {
+            // one round trip per tree level: values and child names of all nodes of the level
+            std::vector<Request> requests;
+            for (const auto& relative_path : level)
+            {
+                requests.push_back({ Method::get_property, node_path + relative_path });
+                if (recursive)
+                {
+                    requests.push_back({ Method::get_names, node_path + relative_path });
+                }
+            }
+            const auto results = call(requests);
+
+            std::vector<std::string> next_level;
+            const size_t stride = recursive ? 2 : 1;
+            for (size_t index = 0; index < level.size(); ++index)
+            {
+                const auto& value = results[index * stride];
+                const auto type = value["type"].asString();
+                // an empty type means the property was removed after its parent node was read
+                if (!type.empty())
+                {
+                    properties.setProperty(level[index], value["value"].asString(), type);
+                }
+                if (recursive)
+                {
+                    auto children = childPaths(level[index], results[index * stride + 1]);
+                    next_level.insert(next_level.end(), children.begin(), children.end());
+                }
+            }
+            level = std::move(next_level);
+        }
+    }
+
+private:
+    /// maximum number of calls within one batch request
+    static constexpr size_t max_batch_size = 256;
+    /// maximum number of concurrent requests if batch requests are not supported
+    static constexpr size_t max_worker_count = 8;
+
+    enum class Method
+    {
+        get_property,
+        get_names
+    };
+
+    struct Request
+    {
+        Method _method;
+        std::string _path;
+    };
+
+    enum class BatchResult
+    {
+        succeeded,
+        /// the participant rejected the batch request as such
+        unsupported,
+        /// e.g. a timeout or an error of a single call
+        failed
+    };
+
+    class Client : public RPCConfigClient
+    {
+    public:
+        using RPCConfigClient::RPCConfigClient;
+        using RPCConfigClient::GetStub;
+    };
+
+    class Response : public IRPCRequester::IRPCResponse
+    {
+    public:
+        fep3::Result set(const std::string& response) override
+        {
+            _response = response;
+            return {};
+        }
+        std::string _response;
+    };
+
+    static std::vector<std::string> childPaths(const std::string& parent, const Json::Value& names)
+    {
+        std::vector<std::string> paths;
+        for (const auto& name : a_util::strings::split(names.asString(), ","))
+        {
+            if (!name.empty())
+            {
+                paths.push_back(parent.empty() ? name : parent + "/" + name);
+            }
+        }
+        return paths;
+    }
+
+    /**
+     * @return the result of every request in order
+     * @throw std::runtime_error if a request fails
+     */
+    std::vector<Json::Value> call(const std::vector<Request>& requests) const
+    {
+        std::vector<Json::Value> results(requests.size());
+        if (_batch_supported)
+        {
+            auto batch_result = BatchResult::succeeded;
+            for (size_t begin = 0; begin < requests.size() && batch_result == BatchResult::succeeded; begin += max_batch_size)
+            {
+                batch_result = callBatch(requests, begin, std::min(requests.size(), begin + max_batch_size), results);
+            }
+            if (batch_result == BatchResult::succeeded)
+            {
+                return results;
+            }
+            if (batch_result == BatchResult::unsupported)
+            {
+                _batch_supported = false;
+            }
+            // a failed batch is repeated as single requests, which report the error if it persists
+        }
+        callConcurrently(requests, results);
+        return results;
+    }
+
+    BatchResult callBatch(const std::vector<Request>& requests, size_t begin, size_t end, std::vector<Json::Value>& results) const
+    {
+        Json::Value batch(Json::arrayValue);
+        for (size_t index = begin; index < end; ++index)
+        {
+            Json::Value call;
+            call["jsonrpc"] = "2.0";
+            call["id"] = static_cast<Json::UInt64>(index);
+            call["method"] = requests[index]._method == Method::get_property ? "getProperty" : "getProperties";
+            call["params"]["property_path"] = requests[index]._path;
+            batch.append(call);
+        }
+
+        Json::StreamWriterBuilder writer;
+        writer["indentation"] = "";
+        Response response;
+        try
+        {
+            if (!_rpc->sendRequest(_component_name, Json::writeString(writer, batch), response))
+            {
+                return BatchResult::failed;
+            }
+        }
+        catch (...)
+        {
+            return BatchResult::failed;
+        }
+
+        Json::Value parsed;
+        std::string errors;
+        std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+        const auto& text = response._response;
+        if (!reader->parse(text.data(), text.data() + text.size(), &parsed, &errors))
+        {
+            return BatchResult::failed;
+        }
+        if (parsed.isObject() && parsed.isMember("error"))
+        {
+            // a server without batch support answers the whole batch with one error
+            return BatchResult::unsupported;
+        }
+        if (!parsed.isArray() || parsed.size() != end - begin)
+        {
+            return BatchResult::failed;
+        }
+        for (const auto& entry : parsed)
+        {
+            if (!entry.isObject() || !entry.isMember("result") || entry["result"].isNull() || !entry["id"].isIntegral())
+            {
+                return BatchResult::failed;
+            }
+            const auto index = entry["id"].asUInt64();
+            if (index < begin || index >= end)
+            {
+                return BatchResult::failed;
+            }
+            results[index] = entry["result"];
+        }
+        return BatchResult::succeeded;
+    }
+
+    void callConcurrently(const std::vector<Request>& requests, std::vector<Json::Value>& results) const
+    {
+        //without a requester factory the one requester of the proxy is used sequentially
+        const size_t worker_count = _requester_factory ?
+            std::max<size_t>(1, std::min(requests.size(), max_worker_count)) : 1;
+        std::atomic<size_t> next_request{ 0 };
+        std::mutex error_sync;
+        std::string error;
+        const auto set_error = [&](const std::string& message)
+        {
+            std::lock_guard<std::mutex> lock(error_sync);
+            if (error.empty())
+            {
+                error = message;
+            }
+            // the other workers stop as well
+            next_request = requests.size();
+        };
+
+        boost::asio::thread_pool pool(worker_count);
+        for (size_t worker = 0; worker < worker_count; ++worker)
+        {
+            boost::asio::post(pool,
+                [&]()
+                {
+                    auto requester = _requester_factory ? _requester_factory() : _rpc;
+                    if (!requester)
+                    {
+                        set_error("no requester available");
+                        return;
+                    }
+                    Client client(_component_name, requester);
+                    for (size_t index = next_request++; index < requests.size(); index = next_request++)
+                    {
+                        try
+                        {
+                            // each request touches a different vector index
+                            if (requests[index]._method == Method::get_property)
+                            {
+                                results[index] = client.GetStub().getProperty(requests[index]._path);
+                            }
+                            else
+                            {
+                                results[index] = client.GetStub().getProperties(requests[index]._path);
+                            }
+                        }
+                        catch (const std::exception& exception)
+                        {
+                            set_error(requests[index]._path + ": " + exception.what());
+                        }
+                        catch (...)
+                        {
+                            set_error(requests[index]._path + ": unknown error");
+                        }
+                    }
+                });
+        }
+        pool.join();
+        if (!error.empty())
+        {
+            throw std::runtime_error("Could not read the properties of " + _component_name + " - " + error);
+        }
+    }
+
+    std::string _component_name;
+    std::shared_ptr<IRPCRequester> _rpc;
+    RequesterFactory _requester_factory;
+    mutable std::atomic<bool> _batch_supported{ true };
+};
+
 class ConfigurationProxy : public RPCConfigProxy
 {
 private:
@@ -70,11 +449,13 @@ private:
     class ConfigurationProperty : public RPCConfigClient,
                                   public IProperties
     {
+        PropertyPath                      _node;
         std::string                       _property_path;
         std::string                       _participant_name;
         std::string                       _component_name;
         ISystemLogger&                    _logger;
-        const std::regex                  _property_path_regex = std::regex("([/]?([a-zA-Z0-9_]+[/]?)*)");
+        std::shared_ptr<const PropertyTreeReader> _tree_reader;
+        std::shared_ptr<PropertyCache>    _cache;
 
     public:
         ConfigurationProperty() = delete;
@@ -87,11 +468,16 @@ private:
             const std::string& participant_name,
             const std::string& component_name,
             const std::shared_ptr<IRPCRequester>& rpc,
-            std::string property_path,
-            ISystemLogger& logger) :
+            PropertyPath node,
+            ISystemLogger& logger,
+            std::shared_ptr<const PropertyTreeReader> tree_reader,
+            std::shared_ptr<PropertyCache> cache) :
             RPCConfigClient(component_name, rpc),
-            _property_path(std::move(property_path)),
+            _node(std::move(node)),
+            _property_path(_node.toNodeString()),
             _logger(logger),
+            _tree_reader(std::move(tree_reader)),
+            _cache(std::move(cache)),
             _component_name(component_name),
             _participant_name(participant_name)
         {
@@ -101,8 +487,8 @@ private:
             const std::string& value,
             const std::string& type)
         {
-            std::string path = _property_path + normalizeName(name);
-            if (!isPropertyPathValid(path))
+            std::string path;
+            if (!resolvePath(name, path))
             {
                 FEP3_CONFIG_LOG_RESULT(
                     fep3::Result(ERR_INVALID_ARG,
@@ -120,10 +506,12 @@ private:
                 int32_t retval = GetStub().setProperty(path, type, value);
                 if (retval == 0)
                 {
+                    _cache->storeType(path, type);
                     return true;
                 }
                 else
                 {
+                    _cache->eraseType(path);
                     fep3::Result ret_code(retval);
                     FEP3_CONFIG_LOG_RESULT(ret_code,
                         _participant_name,
@@ -136,8 +524,8 @@ private:
 
         std::string getProperty(const std::string& name) const
         {
-            std::string path = _property_path + normalizeName(name);
-            if (!isPropertyPathValid(path))
+            std::string path;
+            if (!resolvePath(name, path))
             {
                 FEP3_CONFIG_LOG_RESULT(
                     fep3::Result(ERR_INVALID_ARG,
@@ -152,7 +540,8 @@ private:
             }
             else
             {
-                std::string type = GetStub().getProperty(path)["type"].asString();
+                const auto property = GetStub().getProperty(path);
+                std::string type = property["type"].asString();
                 if (type.empty())
                 {
                     FEP3_CONFIG_LOG_RESULT(
@@ -169,16 +558,16 @@ private:
                 }
                 else
                 {
-                    std::string value = GetStub().getProperty(path)["value"].asString();
-                    return value;
+                    _cache->storeType(path, type);
+                    return property["value"].asString();
                 }
             }
         }
 
         std::string getPropertyType(const std::string& name) const
         {
-            std::string path = _property_path + normalizeName(name);
-            if (!isPropertyPathValid(path))
+            std::string path;
+            if (!resolvePath(name, path))
             {
                 fep3::Result result(ERR_INVALID_ARG);
                 FEP3_CONFIG_LOG_RESULT(result,
@@ -190,8 +579,13 @@ private:
             }
             else
             {
-
-                std::string type = GetStub().getProperty(path)["type"].asString();
+                std::string type;
+                if (_cache->findType(path, type))
+                {
+                    return type;
+                }
+                const auto property = GetStub().getProperty(path);
+                type = property["type"].asString();
                 if (type.empty())
                 {
                     FEP3_CONFIG_LOG_RESULT(fep3::Result(ERR_PATH_NOT_FOUND),
@@ -203,6 +597,7 @@ private:
                 }
                 else
                 {
+                    _cache->storeType(path, type);
                     return type;
                 }
             }
@@ -211,26 +606,13 @@ private:
         bool isEqual(const IProperties& properties) const
         {
             base::Properties<IProperties> mirrored_properties;
-            auto prop_names = getPropertyNames();
-            for (const auto& prop_name : prop_names)
-            {
-                std::string path = _property_path + prop_name;
-                auto val = GetStub().getProperty(path);
-                mirrored_properties.setProperty(prop_name, val["value"].asString(), val["type"].asString());
-            }
+            _tree_reader->readTree(_property_path, mirrored_properties, false);
             return mirrored_properties.isEqual(properties);
         }
 
         void copyTo(IProperties& properties) const
         {
-            base::Properties<IProperties> mirrored_properties;
-            auto prop_names = getPropertyNames();
-            for (const auto& prop_name : prop_names)
-            {
-                std::string path = _property_path + prop_name;
-                auto val = GetStub().getProperty(path);
-                properties.setProperty(prop_name, val["value"].asString(), val["type"].asString());
-            }
+            _tree_reader->readTree(_property_path, properties, false);
         }
 
         std::vector<std::string> getPropertyNames() const
@@ -241,40 +623,26 @@ private:
 
     private:
         /**
-        * @brief Check a property path which includes the property name for validity.
+        * @brief Resolves a property name relative to this node.
+        * Leading and concluding '/' characters of the name are ignored.
         * Currently only the '/' syntax is considered valid.
         * '.' syntax is not supported.
         *
-        * @param property_path the propery path to be checked
+        * @param property_name the property name to be resolved
+        * @param property_path the absolute property path, or the unresolved path if the name is invalid
         *
         * @return bool success boolean
         */
-        bool isPropertyPathValid(const std::string& property_path) const
-        {
-            return std::regex_match(property_path, _property_path_regex);
-        }
-
-        /**
-        * @brief Remove leading and concluding '/' characters a property name.
-        *
-        * @param property_name the propery name to be normalized
-        *
-        * @return string the normalized property name
-        */
-        std::string normalizeName(const std::string& property_name) const
+        bool resolvePath(const std::string& property_name, std::string& property_path) const
         {
-            std::string normalized_name = property_name;
-
-            if (normalized_name.at(0) == '/')
+            const auto relative_path = PropertyPath::parse(property_name);
+            if (!relative_path)
             {
-                normalized_name = normalized_name.substr(1, normalized_name.size());
-            }
-            if (normalized_name.at(normalized_name.size() - 1) == '/')
-            {
-                normalized_name = normalized_name.substr(0, normalized_name.size() - 1);
+                property_path = _property_path + property_name;
+                return false;
             }
-
-            return normalized_name;
+            property_path = _node.append(*relative_path).toString();
+            return true;
         }
     };
 
@@ -283,35 +651,19 @@ public:
     ConfigurationProxy(const std::string& participant_name,
         const std::string& rpc_component_name,
         const std::shared_ptr<IRPCRequester>& rpc,
-        ISystemLogger& logger) :
+        ISystemLogger& logger,
+        std::shared_ptr<PropertyCache> cache = std::make_shared<PropertyCache>(),
+        PropertyTreeReader::RequesterFactory requester_factory = {}) :
         RPCConfigProxy(rpc_component_name, rpc),
         _logger(logger),
         _participant_name(participant_name),
         _component_name(rpc_component_name),
-        _rpc(rpc)
+        _rpc(rpc),
+        _tree_reader(std::make_shared<PropertyTreeReader>(rpc_component_name, rpc, std::move(requester_factory))),
+        _cache(std::move(cache))
     {
     }
 
-    std::string normalizePath(const std::string& property_path) const
-    {
-        if (property_path == "/" || property_path.empty())
-        {
-            return "/";
-        }
-        else
-        {
-            if (property_path.at(property_path.size() - 1) == '/')
-            {
-                return property_path;
-            }
-            else
-            {
-                std::string retval = property_path + "/";
-                return retval;
-            }
-        }
-    }
-
     /**
      * @brief Get a list of the signal names going in
      *
@@ -319,16 +671,18 @@ public:
      */
     std::shared_ptr<IProperties> getProperties(const std::string& property_path) override
     {
-        std::string normalized_path = normalizePath(property_path);
+        const auto node = PropertyPath::parse(property_path);
 
-        if (GetStub().exists(normalized_path))
+        if (node && nodeExists(*node))
         {
             return std::make_shared<ConfigurationProperty>(
                 _participant_name,
                 _component_name,
                 _rpc,
-                normalized_path,
-                _logger);
+                *node,
+                _logger,
+                _tree_reader,
+                _cache);
         }
         else
         {
@@ -351,16 +705,18 @@ public:
      */
     std::shared_ptr<const IProperties> getProperties(const std::string& property_path) const override
     {
-        std::string normalized_path = normalizePath(property_path);
+        const auto node = PropertyPath::parse(property_path);
 
-        if (GetStub().exists(normalized_path))
+        if (node && nodeExists(*node))
         {
             return std::make_shared<ConfigurationProperty>(
                 _participant_name,
                 _component_name,
                 _rpc,
-                normalized_path,
-                _logger);
+                *node,
+                _logger,
+                _tree_reader,
+                _cache);
         }
         else
         {
@@ -376,11 +732,81 @@ public:
         }
     }
 
+    std::shared_ptr<IProperties> getPropertyTree(const std::string& property_path) const override
+    {
+        const auto node = PropertyPath::parse(property_path);
+
+        if (node && nodeExists(*node))
+        {
+            auto properties = std::make_shared<base::Properties<IProperties>>();
+            _tree_reader->readTree(node->toNodeString(), *properties, true);
+            return properties;
+        }
+        else
+        {
+            FEP3_CONFIG_LOG_AND_THROW_RESULT(
+                fep3::Result(ERR_PATH_NOT_FOUND,
+                    a_util::strings::format("Property '%s' does not exist.", property_path.c_str()).c_str(),
+                    0,
+                    "",
+                    ""), _participant_name,
+                _component_name,
+                std::string("getPropertyTree"),
+                property_path);
+        }
+    }
+
+    void getPropertyValue(const std::string& property_path, std::string& value, std::string& type) const override
+    {
+        const auto path = PropertyPath::parse(property_path, true);
+        if (!path)
+        {
+            FEP3_CONFIG_LOG_AND_THROW_RESULT(
+                fep3::Result(ERR_INVALID_ARG,
+                    a_util::strings::format("Property path '%s' is invalid.", property_path.c_str()).c_str(),
+                    0,
+                    "",
+                    ""), _participant_name,
+                _component_name,
+                std::string("getPropertyValue"),
+                property_path);
+        }
+        const auto normalized_path = path->toString();
+        const auto property = GetStub().getProperty(normalized_path);
+        type = property["type"].asString();
+        if (type.empty())
+        {
+            value.clear();
+        }
+        else
+        {
+            _cache->storeType(normalized_path, type);
+            value = property["value"].asString();
+        }
+    }
+
 private:
+    bool nodeExists(const PropertyPath& node) const
+    {
+        const auto normalized_path = node.toNodeString();
+        if (_cache->isKnownNode(normalized_path))
+        {
+            return true;
+        }
+        if (GetStub().exists(normalized_path))
+        {
+            _cache->addKnownNode(normalized_path);
+            return true;
+        }
+        return false;
+    }
+
     ISystemLogger&                    _logger;
     std::string                       _participant_name;
     std::string                       _component_name;
     std::shared_ptr<IRPCRequester> _rpc;
+    std::shared_ptr<const PropertyTreeReader> _tree_reader;
+    std::shared_ptr<PropertyCache> _cache;
 };
 
 }
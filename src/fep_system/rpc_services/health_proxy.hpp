@@ -23,11 +23,12 @@ You may add additional accurate notices of copyright ownership.
 
 #include "health_service_proxy_stub.h"
 #include "rpc_services/health/health_service_rpc_intf.h"
+#include "compact_jobs_health.h"
 
 #include <components/service_bus/rpc/fep_rpc_stubs_client.h>
 #include <fep3/components/service_bus/rpc/fep_rpc.h>
 #include <string>
-#include <cassert>
+#include <string_view>
 #include <a_util/strings.h>
 
 namespace fep3::rpc::catelyn
@@ -36,11 +37,12 @@ namespace fep3::rpc::catelyn
 //we use the namespace here to create versioned Proxies if something changes in future
 
 class HealthServiceProxy : public rpc::arya::RPCServiceClientProxy<rpc_proxy_stub::RPCHealthServiceProxy,
-    IRPCHealthService>
+    IRPCHealthService>, public ICompactHealthSource
 {
 private:
     using base_type =
         rpc::RPCServiceClientProxy<rpc_proxy_stub::RPCHealthServiceProxy, IRPCHealthService>;
+    using ExecuteStep = CompactJobsHealth::ExecuteStep;
 
 public:
     using base_type::GetStub;
@@ -50,49 +52,53 @@ public:
         base_type(rpc_component_name, rpc)
     {
     }
-    //TODO MAYBE OPTIONAL
+
     std::vector<JobHealthiness> getHealth() const override
     {
-       try
+        CompactJobsHealth jobs_health;
+        getCompactHealth(jobs_health);
+        return jobs_health.toJobsHealthiness();
+    }
+
+    // decodes the reply in one pass, without any JobHealthiness in between
+    void getCompactHealth(CompactJobsHealth& jobs_health) const override
+    {
+        jobs_health.clear();
+        try
         {
-            auto ret_value = GetStub().getHealth();
-            if (!ret_value.isMember("jobs_healthiness"))
+            const auto ret_value = GetStub().getHealth();
+            const auto& jobs = ret_value["jobs_healthiness"];
+            if (!jobs.isArray())
             {
-                return {};
+                return;
             }
-
-            auto json_value_array = ret_value["jobs_healthiness"];
-            if (json_value_array.isArray())
+            jobs_health.reserve(jobs.size());
+            for (const auto& job : jobs)
             {
-                std::vector<JobHealthiness> jobs_healthiness;
-                jobs_healthiness.reserve(json_value_array.size());
-
-                for (auto json_value_job_health = json_value_array.begin(); json_value_job_health != json_value_array.end(); ++json_value_job_health)
+                const auto simulation_time = std::chrono::nanoseconds(job["simulation_timestamp"].asInt64());
+                const auto& cycle_time = job["cycle_time"];
+                if (!cycle_time.empty())
                 {
-                    auto& healthiness = (*json_value_job_health);
-                    JobHealthiness job_healthiness =
-
+                    jobs_health.addClockTriggeredJob(toStringView(job["job_name"]),
+                        std::chrono::nanoseconds(cycle_time.asInt64()),
+                        simulation_time);
+                }
+                else
+                {
+                    jobs_health.addDataTriggeredJob(toStringView(job["job_name"]), simulation_time);
+                    for (const auto& trigger_signal : job["trigger_signals"])
                     {
-                       healthiness["job_name"].asString(),
-                       getJobInfo(healthiness),
-                       std::chrono::nanoseconds(healthiness["simulation_timestamp"].asInt64()) };
-
-                    job_healthiness.execute_data_in_error = json_to_execute_error(healthiness["last_execute_data_in_error"]);
-                    job_healthiness.execute_error = json_to_execute_error(healthiness["last_execute_error"]);
-                    job_healthiness.execute_data_out_error = json_to_execute_error(healthiness["last_execute_data_out_error"]);
-
-                    jobs_healthiness.push_back(std::move(job_healthiness));
+                        jobs_health.addTriggerSignal(toStringView(trigger_signal));
+                    }
                 }
-                return jobs_healthiness;
-            }
-            else
-            {
-                return {};
+                decodeExecuteError(job["last_execute_data_in_error"], ExecuteStep::data_in, jobs_health);
+                decodeExecuteError(job["last_execute_error"], ExecuteStep::execute, jobs_health);
+                decodeExecuteError(job["last_execute_data_out_error"], ExecuteStep::data_out, jobs_health);
             }
         }
         catch (const std::exception&)
         {
-            return {};
+            jobs_health.clear();
         }
     }
 
@@ -108,43 +114,28 @@ public:
         }
     }
 private:
-    std::variant<fep3::JobHealthiness::ClockTriggeredJobInfo, fep3::JobHealthiness::DataTriggeredJobInfo>
-        getJobInfo(const Json::Value& value) const
+    static std::string_view toStringView(const Json::Value& value)
     {
-        if (!value["cycle_time"].empty())
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        if (value.isString() && value.getString(&begin, &end))
         {
-            return fep3::JobHealthiness::ClockTriggeredJobInfo{ std::chrono::nanoseconds(value["cycle_time"].asInt64()) };
+            return std::string_view(begin, static_cast<size_t>(end - begin));
         }
-        else
-        {
-            assert(value["trigger_signals"].isArray());
-            const auto& array_val = value["trigger_signals"];
-            std::vector<std::string> trigger_signals;
-            trigger_signals.reserve(value["trigger_signals"].size());
-
-            for (decltype(value["trigger_signals"].size()) i = 0; i < value["trigger_signals"].size(); ++i)
-            {
-                trigger_signals.push_back(array_val[i].asString());
-            }
-            return fep3::JobHealthiness::DataTriggeredJobInfo{ std::move(trigger_signals) };
-        }
-    }
-
-    JobHealthiness::ExecuteError json_to_execute_error(const Json::Value& value) const
-    {
-        return JobHealthiness::ExecuteError{ value["error_count"].asUInt64(),
-        std::chrono::nanoseconds(value["simulation_timestamp"].asInt64()),
-        json_to_error(value["last_error"])};
+        return {};
     }
 
-    fep3::JobHealthiness::ExecuteResult json_to_error(const Json::Value& value) const
+    static void decodeExecuteError(const Json::Value& value, ExecuteStep step, CompactJobsHealth& jobs_health)
     {
-        return fep3::JobHealthiness::ExecuteResult{
-            value["error_code"].asInt(),
-            value["description"].asCString(),
-            value["line"].asInt(),
-            value["file"].asCString(),
-            value["function"].asCString() };
+        const auto& last_error = value["last_error"];
+        jobs_health.setExecuteError(step,
+            value["error_count"].asUInt64(),
+            std::chrono::nanoseconds(value["simulation_timestamp"].asInt64()),
+            last_error["error_code"].asInt(),
+            toStringView(last_error["description"]),
+            last_error["line"].asInt(),
+            toStringView(last_error["file"]),
+            toStringView(last_error["function"]));
     }
 };
 
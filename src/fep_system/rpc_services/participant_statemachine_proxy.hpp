@@ -20,6 +20,7 @@ You may add additional accurate notices of copyright ownership.
 
 #pragma once
 #include <string>
+#include <functional>
 
 #include <components/service_bus/rpc/fep_rpc_stubs_client.h>
 #include <fep_system_stubs/participant_statemachine_proxy_stub.h>
@@ -53,11 +54,16 @@ private:
         IRPCParticipantStateMachine > base_type;
 
 public:
+    /// called after each transition request, the participant may change its rpc components on transitions
+    using TransitionCallback = std::function<void()>;
+
     using base_type::GetStub;
     ParticipantStateMachineProxy(
         std::string rpc_component_name,
-        std::shared_ptr<IRPCRequester> rpc) :
-        base_type(rpc_component_name, rpc)
+        std::shared_ptr<IRPCRequester> rpc,
+        TransitionCallback on_transition = {}) :
+        base_type(rpc_component_name, rpc),
+        _on_transition(std::move(on_transition))
     {
 
     }
@@ -104,6 +110,7 @@ public:
     void load() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().load(); }, "loading");
         if (!change_succeeded)
         {
@@ -113,6 +120,7 @@ public:
     void unload() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().unload(); }, "unloading");
         if (!change_succeeded)
         {
@@ -123,6 +131,7 @@ public:
     void initialize() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().initialize(); }, "initializing");
         if (!change_succeeded)
         {
@@ -132,6 +141,7 @@ public:
     void deinitialize() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().deinitialize(); }, "deinitializing");
         if (!change_succeeded)
         {
@@ -141,6 +151,7 @@ public:
     void start() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().start(); }, "starting");
         if (!change_succeeded)
         {
@@ -150,6 +161,7 @@ public:
     void stop() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().stop(); }, "stopping");
         if (!change_succeeded)
         {
@@ -159,6 +171,7 @@ public:
     void pause() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().pause(); }, "pausing");
         if (!change_succeeded)
         {
@@ -169,6 +182,7 @@ public:
     void shutdown() override
     {
         auto change_succeeded = false;
+        TransitionNotifier notifier(_on_transition);
         CALL_WITH_TIMEOUT({ change_succeeded = GetStub().exit(); }, "shutdowning");
         if (!change_succeeded)
         {
@@ -176,6 +190,26 @@ public:
         }
     }
 
+private:
+    /// invokes the transition callback when leaving the scope, regardless of the transition result
+    class TransitionNotifier
+    {
+    public:
+        explicit TransitionNotifier(const TransitionCallback& on_transition) : _on_transition(on_transition)
+        {
+        }
+        ~TransitionNotifier()
+        {
+            if (_on_transition)
+            {
+                _on_transition();
+            }
+        }
+    private:
+        const TransitionCallback& _on_transition;
+    };
+
+    TransitionCallback _on_transition;
 };
 }
 }
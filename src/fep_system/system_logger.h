@@ -26,8 +26,14 @@ You may add additional accurate notices of copyright ownership.
 #include "fep_system/system_logger_intf.h"
 
 #include "rpc_services/logging/logging_rpc_intf.h"
+#include "rpc_services/logging/logging_batch_sink_rpc_intf_def.h"
 #include <fep3/components/service_bus/rpc/fep_rpc.h>
 #include "fep_system_stubs/logging_sink_stub.h"
+#include "fep_system_stubs/logging_batch_sink_stub.h"
+#include "event_monitor_list.h"
+#include "log_batch.h"
+#include "log_dispatcher.h"
+#include "log_name_table.h"
 
 #include <mutex>
 
@@ -50,17 +56,43 @@ namespace fep3
             int severity,
             const std::string& timestamp) override
         {
-            _system_logger.log(
-                std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::nanoseconds(a_util::strings::toInt64(timestamp))),
+            // filtered before the timestamp is parsed
+            if (!_system_logger.isSeverityEnabled(static_cast<LoggerSeverity>(severity)))
+            {
+                return 0;
+            }
+            _system_logger.log(LogRecord(
+                std::chrono::nanoseconds(a_util::strings::toInt64(timestamp)),
                 static_cast<LoggerSeverity>(severity),
-                participant,
-                logger_name,
-                description);
+                LogNameTable::intern(participant),
+                LogNameTable::intern(logger_name),
+                description));
             return 0;
         }
     };
 
+    using LogBatchSink = rpc::RPCService<rpc_proxy_stub::RPCLoggingBatchSink, rpc::IRPCLoggingBatchSinkClientDef>;
+    /**
+     * Receives several log records of one participant per call.
+     * Every record is an array of [timestamp in ns, severity, logger name, description].
+     * Malformed records are skipped, the number of well formed records is returned.
+     */
+    class LogBatchSinkImpl : public LogBatchSink
+    {
+    private:
+        ISystemLogger& _system_logger;
+
+    public:
+        explicit LogBatchSinkImpl(ISystemLogger& system_logger) : _system_logger(system_logger)
+        {
+        }
+        int onLogBatch(const std::string& participant,
+            const Json::Value& records) override
+        {
+            return logRecordBatch(_system_logger, participant, records);
+        }
+    };
+
     class SystemLogger :
         public ISystemLogger
     {
@@ -74,18 +106,20 @@ namespace fep3
         {
             _system_access->getServer()->unregisterService(
                 rpc::IRPCLoggingSinkClientDef::getRPCDefaultName());
+            _system_access->getServer()->unregisterService(
+                rpc::IRPCLoggingBatchSinkClientDef::getRPCDefaultName());
+            // delivers the queued records
+            std::atomic_store(&_dispatcher, std::shared_ptr<LogDispatcher>());
         }
 
-        void registerMonitor(IEventMonitor* monitor)
+        void registerMonitor(IEventMonitor& monitor, const EventMonitorFilter& filter)
         {
-            std::lock_guard<std::recursive_mutex> _lock(_synch_event_monitor);
-            _monitor = monitor;
+            _monitors.add(monitor, filter);
         }
 
-        void releaseMonitor()
+        void unregisterMonitor(IEventMonitor& monitor)
         {
-            std::lock_guard<std::recursive_mutex> _lock(_synch_event_monitor);
-            _monitor = nullptr;
+            _monitors.remove(monitor);
         }
 
         void log(const std::chrono::milliseconds& time_as_ms,
@@ -94,11 +128,15 @@ namespace fep3
             const std::string& logger_name, //depends on the Category ...
             const std::string& message) const
         {
-            std::lock_guard<std::recursive_mutex> _lock(_synch_event_monitor);
-            if (_monitor)
+            if (!isSeverityEnabled(level))
             {
-                _monitor->onLog(time_as_ms, level, participant_name, logger_name, message);
+                return;
             }
+            log(LogRecord(time_as_ms,
+                level,
+                LogNameTable::intern(participant_name),
+                LogNameTable::intern(logger_name),
+                message));
         }
         void log(
             LoggerSeverity level,
@@ -106,9 +144,33 @@ namespace fep3
             const std::string& logger_name, //depends on the Category ...
             const std::string& message) const
         {
-            auto log_time_point = std::chrono::system_clock::now();
-            auto time_as_ms = std::chrono::milliseconds(std::chrono::system_clock::to_time_t(log_time_point));
-            log(time_as_ms, level, participant_name, logger_name, message);
+            if (!isSeverityEnabled(level))
+            {
+                return;
+            }
+            log(LogRecord(std::chrono::system_clock::now().time_since_epoch(),
+                level,
+                LogNameTable::intern(participant_name),
+                LogNameTable::intern(logger_name),
+                message));
+        }
+        void log(LogRecord&& record) const override
+        {
+            if (!isSeverityEnabled(record._severity))
+            {
+                return;
+            }
+            if (const auto dispatcher = std::atomic_load(&_dispatcher))
+            {
+                dispatcher->push(std::move(record));
+                return;
+            }
+            deliver(record);
+        }
+
+        bool isSeverityEnabled(LoggerSeverity level) const override
+        {
+            return level != LoggerSeverity::off && static_cast<int>(level) <= static_cast<int>(_level.load());
         }
 
         void setSeverityLevel(LoggerSeverity level)
@@ -116,6 +178,49 @@ namespace fep3
             _level = level;
         }
 
+        LoggerSeverity getSeverityLevel() const
+        {
+            return _level;
+        }
+
+        void setAsyncLogging(const AsyncLoggingConfig& config)
+        {
+            std::lock_guard<std::mutex> lock(_synch_dispatcher);
+            std::shared_ptr<LogDispatcher> dispatcher;
+            if (config._enabled)
+            {
+                dispatcher = std::make_shared<LogDispatcher>(config._queue_capacity,
+                    config._overflow_policy,
+                    _dispatch_counters,
+                    [this](const LogRecord& record)
+                    {
+                        deliver(record);
+                    });
+            }
+            _async_logging_config = config;
+            // the former dispatcher delivers its queued records when the last logging call using it returned
+            std::atomic_store(&_dispatcher, std::move(dispatcher));
+        }
+
+        AsyncLoggingConfig getAsyncLogging() const
+        {
+            std::lock_guard<std::mutex> lock(_synch_dispatcher);
+            return _async_logging_config;
+        }
+
+        LoggingMetrics getLoggingMetrics() const
+        {
+            LoggingMetrics metrics;
+            metrics._delivered = _dispatch_counters._delivered;
+            metrics._dropped = _dispatch_counters._dropped;
+            metrics._blocked = _dispatch_counters._blocked;
+            if (const auto dispatcher = std::atomic_load(&_dispatcher))
+            {
+                metrics._queued = dispatcher->getQueuedCount();
+            }
+            return metrics;
+        }
+
         void initRPCService(const std::string& system_name)
         {
             //we create an server that is not discoverable
@@ -137,6 +242,10 @@ namespace fep3
             _system_access->getServer()->registerService(
                 rpc::IRPCLoggingSinkClientDef::getRPCDefaultName(),
                 _log_sink_impl);
+            _log_batch_sink_impl = std::make_shared<LogBatchSinkImpl>(*this);
+            _system_access->getServer()->registerService(
+                rpc::IRPCLoggingBatchSinkClientDef::getRPCDefaultName(),
+                _log_batch_sink_impl);
         }
 
         std::string getUrl() const
@@ -154,6 +263,11 @@ namespace fep3
             return{};
         }
 
+        void deliver(const LogRecord& record) const
+        {
+            _monitors.dispatch(record);
+        }
+
         static int getId()
         {
             static int counter = 0;
@@ -162,12 +276,18 @@ namespace fep3
             return counter++;
         }
 
-        LoggerSeverity _level = LoggerSeverity::info;
-        IEventMonitor* _monitor = nullptr;
-        mutable std::recursive_mutex _synch_event_monitor;
+        std::atomic<LoggerSeverity> _level{ LoggerSeverity::info };
+        EventMonitorList _monitors;
         std::shared_ptr<fep3::IServiceBus::ISystemAccess> _system_access;
         ServiceBusWrapper _servicebus_connection;
         std::shared_ptr<LogSinkImpl> _log_sink_impl;
+        std::shared_ptr<LogBatchSinkImpl> _log_batch_sink_impl;
+        /// serializes the reconfiguration of the asynchronous logging
+        mutable std::mutex _synch_dispatcher;
+        AsyncLoggingConfig _async_logging_config;
+        LogDispatchCounters _dispatch_counters;
+        /// set if the log records are delivered asynchronously, accessed with std::atomic_load and std::atomic_store only
+        std::shared_ptr<LogDispatcher> _dispatcher;
 
     };
 }
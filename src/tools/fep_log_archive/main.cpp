@@ -0,0 +1,145 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_archive_query.h"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace
+{
+const std::map<std::string, fep3::LoggerSeverity> severities = {
+    { "fatal", fep3::LoggerSeverity::fatal },
+    { "error", fep3::LoggerSeverity::error },
+    { "warning", fep3::LoggerSeverity::warning },
+    { "info", fep3::LoggerSeverity::info },
+    { "debug", fep3::LoggerSeverity::debug } };
+
+int printUsage()
+{
+    std::cerr << "usage: fep_log_archive <directory> [options]\n"
+        "queries the log archive written by fep3::LogArchive, one record per line:\n"
+        "<time in ns since the epoch> <severity> <participant> <logger> <message>\n"
+        "  --begin <ns>          only records logged at or after this time\n"
+        "  --end <ns>            only records logged before this time\n"
+        "  --participant <name>  only records of this participant, may be repeated, \"\" selects the system\n"
+        "  --severity <level>    only records of this or a higher severity:\n"
+        "                        fatal, error, warning, info or debug (default)\n"
+        "  --limit <count>       stops after this number of records\n"
+        "  --count               prints the number of selected records only\n";
+    return 1;
+}
+
+const char* getSeverityName(fep3::LoggerSeverity severity)
+{
+    for (const auto& name_and_severity : severities)
+    {
+        if (name_and_severity.second == severity)
+        {
+            return name_and_severity.first.c_str();
+        }
+    }
+    return "off";
+}
+
+bool parseNumber(const std::string& text, long long& number)
+{
+    char* end = nullptr;
+    number = std::strtoll(text.c_str(), &end, 10);
+    return !text.empty() && *end == '\0';
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        return printUsage();
+    }
+    const std::string directory = argv[1];
+    fep3::LogArchiveQuery query;
+    long long limit = 0;
+    bool count_only = false;
+    for (int index = 2; index < argc; ++index)
+    {
+        const std::string option = argv[index];
+        if (option == "--count")
+        {
+            count_only = true;
+            continue;
+        }
+        if (index + 1 == argc)
+        {
+            return printUsage();
+        }
+        const std::string value = argv[++index];
+        long long number = 0;
+        if (option == "--begin" && parseNumber(value, number))
+        {
+            query._begin = std::chrono::nanoseconds(number);
+        }
+        else if (option == "--end" && parseNumber(value, number))
+        {
+            query._end = std::chrono::nanoseconds(number);
+        }
+        else if (option == "--limit" && parseNumber(value, number) && number > 0)
+        {
+            limit = number;
+        }
+        else if (option == "--participant")
+        {
+            query._participant_names.insert(value);
+        }
+        else if (option == "--severity" && severities.count(value) != 0)
+        {
+            query._severity = severities.at(value);
+        }
+        else
+        {
+            return printUsage();
+        }
+    }
+
+    try
+    {
+        long long remaining = limit;
+        const auto count = fep3::queryLogArchive(directory, query,
+            [&](const fep3::LogArchiveEntry& entry) {
+                if (!count_only)
+                {
+                    std::cout << entry._timestamp.count() << ' ' << getSeverityName(entry._severity) << ' '
+                        << entry._participant_name << ' ' << entry._logger_name << ' ' << entry._message << '\n';
+                }
+                return limit == 0 || --remaining > 0;
+            });
+        if (count_only)
+        {
+            std::cout << count << '\n';
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << "unable to read the log archive: " << exception.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
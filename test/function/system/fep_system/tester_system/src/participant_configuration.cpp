@@ -121,6 +121,49 @@ TEST(ParticipantConfiguration, TestProxyConfigSetter)
         std::string("init_val"), std::string("string_value"), "deeper");
 }
 
+TEST(ParticipantConfiguration, TestProxyConfigPropertyTree)
+{
+    using namespace fep3;
+    const std::string system_name = makePlatformDepName("Blackbox");
+
+    auto parts = createTestParticipants({ "Participant1_configuration_test" }, system_name);
+    fep3::System system_under_test = fep3::discoverSystem(system_name, { "Participant1_configuration_test" }, 4000ms);
+
+    auto p1 = system_under_test.getParticipant("Participant1_configuration_test");
+
+    auto config = p1.getRPCComponentProxyByIID<fep3::rpc::IRPCConfiguration>();
+    ASSERT_TRUE(static_cast<bool>(config));
+
+    auto& part = parts["Participant1_configuration_test"];
+    auto config_service = part->_part.getComponent<IConfigurationService>();
+
+    auto props = std::make_shared<base::NativePropertyNode>("deeper");
+    auto nested = base::makeNativePropertyNode("nested", 2);
+    nested->setChild(base::makeNativePropertyNode("string_value", std::string("nested_value")));
+    props->setChild(base::makeNativePropertyNode("int_value", 1));
+    props->setChild(nested);
+    config_service->registerNode(props);
+
+    // the tree contains nested nodes, relative to the requested node
+    auto tree = config.getInterface()->getPropertyTree("deeper");
+    ASSERT_TRUE(tree);
+    EXPECT_EQ(tree->getProperty("int_value"), "1");
+    EXPECT_EQ(tree->getProperty("nested"), "2");
+    EXPECT_EQ(tree->getProperty("nested/string_value"), "nested_value");
+    EXPECT_EQ(tree->getPropertyType("nested/string_value"), "string");
+
+    // copyTo only copies the direct children of the node
+    auto node = config.getInterface()->getProperties("deeper");
+    base::Properties<IProperties> copied;
+    node->copyTo(copied);
+    EXPECT_EQ(copied.getProperty("int_value"), "1");
+    EXPECT_EQ(copied.getProperty("nested"), "2");
+    EXPECT_TRUE(copied.getProperty("nested/string_value").empty());
+    EXPECT_TRUE(node->isEqual(copied));
+
+    EXPECT_THROW(config.getInterface()->getPropertyTree("not_existing"), std::runtime_error);
+}
+
 TEST(ParticipantConfiguration, TestProxyConfigArraySetter)
 {
     using namespace fep3;
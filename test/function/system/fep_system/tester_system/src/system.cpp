@@ -33,6 +33,7 @@ You may add additional accurate notices of copyright ownership.
 #include <gmock/gmock.h>
 #include <fep_system/fep_system.h>
 #include <string.h>
+#include <cstdio>
 #include <functional>
 #include <fep_test_common.h>
 #include <a_util/logging.h>
@@ -981,6 +982,8 @@ TEST_F(SystemLibraryWithTestSystem, TestGetAClock)
         using namespace std::chrono;
         TestEventMonitor tem;
         my_sys.registerMonitoring(tem);
+        // the clock sync messages are debug messages
+        my_sys.setSeverityLevel(fep3::LoggerSeverity::debug);
 
         my_sys.load();
 
@@ -1034,6 +1037,18 @@ TEST_F(SystemLibraryWithTestSystem, TestGetAClock)
         EXPECT_LT(diff, fep3::Duration(participant_start_delay).count())
             << "Difference of timing client time and timing master time exceeded '1s': " << duration_cast<milliseconds>(nanoseconds(diff)).count();
 
+        // the timing master is the reference by default
+        const auto offsets = my_sys.measureClockOffsets(4);
+        ASSERT_EQ(offsets.size(), 2u);
+        EXPECT_EQ(offsets.at(part_name_1)._offset, 0ns);
+        EXPECT_EQ(offsets.at(part_name_1)._samples, 4u);
+        const auto& offset_part2 = offsets.at(part_name_2);
+        EXPECT_TRUE(offset_part2._error.empty()) << offset_part2._error;
+        EXPECT_EQ(offset_part2._samples, 4u);
+        EXPECT_GT(offset_part2._uncertainty, 0ns);
+        EXPECT_LT(abs(offset_part2._offset), participant_start_delay);
+        ASSERT_THROW(my_sys.measureClockOffsets(4, "unknown_participant"), std::runtime_error);
+
         ASSERT_NO_THROW(
             my_sys.setSystemState(fep3::System::AggregatedState::unloaded);
         );
@@ -1117,6 +1132,164 @@ TEST_F(SystemLibraryWithTestSystem, getTimingPropertiesRealTime)
     EXPECT_EQ(my_sys.getParticipants().size(), 1);
  }
 
+/**
+ * Test setting and getting several properties of several participants at once
+ *
+ * @testData        none
+ * @testType        functional
+ * @precondition    none
+ * @postcondition   none
+ * @expectedResult  no deviations
+ */
+TEST_F(SystemLibraryWithTestSystem, setAndGetParticipantProperties)
+{
+    using namespace std::literals::chrono_literals;
+    my_sys = fep3::discoverSystem(sys_name, participant_names, 4000ms);
+
+    my_sys.load();
+
+    auto set_results = my_sys.setParticipantProperties({
+        { part_name_1, { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME } } },
+        { part_name_2, { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME },
+                         { "clock/does_not_exist", "value" } } },
+        { "not_existing_participant", { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME } } } });
+
+    ASSERT_EQ(set_results.size(), 3);
+    EXPECT_TRUE(set_results[part_name_1]._errors.empty());
+    ASSERT_EQ(set_results[part_name_2]._errors.size(), 1);
+    EXPECT_EQ(set_results[part_name_2]._errors.count("clock/does_not_exist"), 1);
+    EXPECT_EQ(set_results["not_existing_participant"]._errors.count(""), 1);
+
+    auto get_results = my_sys.getPropertiesOfAllParticipants({ FEP3_CLOCK_SERVICE_MAIN_CLOCK });
+    ASSERT_EQ(get_results.size(), 2);
+    EXPECT_EQ(get_results[part_name_1]._values[FEP3_CLOCK_SERVICE_MAIN_CLOCK], FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME);
+    EXPECT_EQ(get_results[part_name_2]._values[FEP3_CLOCK_SERVICE_MAIN_CLOCK], FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+
+    set_results = my_sys.setPropertiesOfAllParticipants({ { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME } });
+    for (const auto& [participant_name, result] : set_results)
+    {
+        EXPECT_TRUE(result._errors.empty()) << participant_name;
+    }
+    EXPECT_EQ(my_sys.getParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK), FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+}
+
+/**
+ * Test that applying a desired configuration only writes changed properties
+ *
+ * @testData        none
+ * @testType        functional
+ * @precondition    none
+ * @postcondition   none
+ * @expectedResult  no deviations
+ */
+TEST_F(SystemLibraryWithTestSystem, applyDesiredConfiguration)
+{
+    using namespace std::literals::chrono_literals;
+    my_sys = fep3::discoverSystem(sys_name, participant_names, 4000ms);
+
+    my_sys.load();
+    my_sys.setParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+    my_sys.setParticipantProperty(part_name_2, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+
+    auto results = my_sys.applyDesiredConfiguration({
+        { part_name_1, { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME } } },
+        { part_name_2, { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME },
+                         { "clock/does_not_exist", "value" } } } });
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[part_name_1]._written, 1u);
+    EXPECT_EQ(results[part_name_1]._skipped, 0u);
+    EXPECT_TRUE(results[part_name_1]._errors.empty());
+    EXPECT_EQ(results[part_name_2]._written, 0u);
+    EXPECT_EQ(results[part_name_2]._skipped, 1u);
+    EXPECT_EQ(results[part_name_2]._errors.count("clock/does_not_exist"), 1);
+    EXPECT_EQ(my_sys.getParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK), FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME);
+}
+
+/**
+ * Test that a saved configuration snapshot restores the changed properties and priorities
+ *
+ * @testData        none
+ * @testType        functional
+ * @precondition    none
+ * @postcondition   none
+ * @expectedResult  no deviations
+ */
+TEST_F(SystemLibraryWithTestSystem, saveAndRestoreConfiguration)
+{
+    using namespace std::literals::chrono_literals;
+    my_sys = fep3::discoverSystem(sys_name, participant_names, 4000ms);
+    const std::string snapshot_file = makePlatformDepName("configuration_snapshot") + ".jsonl";
+
+    my_sys.load();
+    my_sys.setParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME);
+    my_sys.getParticipant(part_name_1).setInitPriority(7);
+
+    const auto save_results = my_sys.saveConfiguration(snapshot_file);
+    ASSERT_EQ(save_results.size(), 2);
+    for (const auto& [participant_name, result] : save_results)
+    {
+        EXPECT_TRUE(result._errors.empty()) << participant_name;
+    }
+
+    my_sys.setParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+    my_sys.getParticipant(part_name_1).setInitPriority(0);
+
+    auto restore_results = my_sys.restoreConfiguration(snapshot_file);
+    ASSERT_EQ(restore_results.size(), 2);
+    EXPECT_EQ(restore_results[part_name_1]._written, 1u);
+    EXPECT_GT(restore_results[part_name_1]._skipped, 0u);
+    EXPECT_TRUE(restore_results[part_name_1]._errors.empty());
+    EXPECT_EQ(restore_results[part_name_2]._written, 0u);
+    EXPECT_TRUE(restore_results[part_name_2]._errors.empty());
+    EXPECT_EQ(my_sys.getParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK), FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME);
+    EXPECT_EQ(my_sys.getParticipant(part_name_1).getInitPriority(), 7);
+
+    std::remove(snapshot_file.c_str());
+    EXPECT_THROW(my_sys.restoreConfiguration(snapshot_file), std::runtime_error);
+}
+
+/**
+ * Test that the property mirror answers queries over all participants and follows own writes
+ *
+ * @testData        none
+ * @testType        functional
+ * @precondition    none
+ * @postcondition   none
+ * @expectedResult  no deviations
+ */
+TEST_F(SystemLibraryWithTestSystem, queryPropertyMirror)
+{
+    using namespace std::literals::chrono_literals;
+    my_sys = fep3::discoverSystem(sys_name, participant_names, 4000ms);
+
+    my_sys.load();
+    EXPECT_TRUE(my_sys.queryMirroredProperties("clock/*").empty());
+
+    my_sys.setParticipantProperty(part_name_1, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME);
+    my_sys.setParticipantProperty(part_name_2, FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+    const auto refresh_results = my_sys.refreshPropertyMirror();
+    ASSERT_EQ(refresh_results.size(), 2);
+    for (const auto& [participant_name, result] : refresh_results)
+    {
+        EXPECT_TRUE(result._errors.empty()) << participant_name;
+    }
+
+    EXPECT_EQ(my_sys.findParticipantsByMirroredProperty(FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME),
+        std::vector<std::string>{ part_name_1 });
+    auto values = my_sys.queryMirroredProperties("clock/*");
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[part_name_2][FEP3_CLOCK_SERVICE_MAIN_CLOCK], FEP3_CLOCK_LOCAL_SYSTEM_REAL_TIME);
+
+    my_sys.setParticipantProperties({ { part_name_2, { { FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME } } } });
+    const auto expected_participants = std::vector<std::string>{ part_name_1, part_name_2 };
+    EXPECT_EQ(my_sys.findParticipantsByMirroredProperty(FEP3_CLOCK_SERVICE_MAIN_CLOCK, FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME),
+        expected_participants);
+
+    my_sys.remove(part_name_2);
+    EXPECT_EQ(my_sys.queryMirroredProperties("clock/*").count(part_name_2), 0);
+}
+
 TEST(SystemLibrary, getTimingPropertiesAFAP)
 {
     const std::string sys_name = makePlatformDepName("system_under_test");
@@ -47,6 +47,8 @@ struct SystemHealthTest : public testing::Test
         using namespace std::chrono_literals;
         _participants = createTestParticipants({ _participant_name }, _system_name);
         _system = fep3::discoverSystem(_system_name, { _participant_name }, 10s);
+        // the tests wait for the debug messages of the health listener
+        _system.setSeverityLevel(fep3::LoggerSeverity::debug);
     }
 
     fep3::System _system;
@@ -164,6 +166,33 @@ private:
 /**
  * @brief Test whether the system library returns the correct participant health state via rpc using getHealth.
  */
+class TestHealthMonitor : public fep3::IHealthMonitor
+{
+public:
+    TestHealthMonitor(std::future<void>& offline_future, std::string participant_name)
+        : _participant_name(std::move(participant_name))
+    {
+        offline_future = _offline_promise.get_future();
+    }
+
+    void onHealthChanged(const std::map<std::string, ParticipantHealth>& participants_health) override
+    {
+        const auto participant_health = participants_health.find(_participant_name);
+        if (participant_health != participants_health.end()
+            && participant_health->second.running_state == ParticipantRunningState::offline
+            && !_offline)
+        {
+            _offline = true;
+            _offline_promise.set_value();
+        }
+    }
+
+private:
+    const std::string _participant_name;
+    std::promise<void> _offline_promise;
+    bool _offline = false;
+};
+
 TEST_F(SystemHealthTest, TestParticpantGetHealth)
 {
     std::future<void> log_future;
@@ -354,6 +383,100 @@ TEST_F(SystemHealthTest, TestParticpantGetHealthOnDeactivatedListenerFromPartici
     ASSERT_EQ(participant_health.running_state, ParticipantRunningState::offline);
 }
 
+TEST_F(SystemHealthTest, TestParticpantGetHealthSince)
+{
+    using namespace std::chrono_literals;
+    // wait for a heartbeat
+    std::future<void> log_future;
+    TestEventMonitor tem(log_future, "Received update event from ");
+    _system.registerMonitoring(tem);
+    log_future.wait_for(10s);
+    _system.unregisterMonitoring(tem);
+
+    const auto all_changes = _system.getParticipantsHealthSince(0);
+    ASSERT_EQ(all_changes.participants_health.size(), 1);
+    ASSERT_EQ(all_changes.participants_health.count(_participant_name), 1);
+    ASSERT_EQ(all_changes.participants_health.at(_participant_name).running_state, ParticipantRunningState::online);
+    ASSERT_GT(all_changes.version, 0);
+
+    // the participant is not running, so its health does not change
+    const auto no_changes = _system.getParticipantsHealthSince(all_changes.version);
+    ASSERT_TRUE(no_changes.participants_health.empty());
+    ASSERT_GE(no_changes.version, all_changes.version);
+
+    // going offline is a change
+    _participants[_participant_name]->_part_executor.shutdown();
+    _system.setLivelinessTimeout(10ns);
+    std::this_thread::sleep_for(1s);
+
+    const auto offline_changes = _system.getParticipantsHealthSince(no_changes.version);
+    ASSERT_EQ(offline_changes.participants_health.size(), 1);
+    ASSERT_EQ(offline_changes.participants_health.at(_participant_name).running_state, ParticipantRunningState::offline);
+    ASSERT_GT(offline_changes.version, no_changes.version);
+}
+
+TEST_F(SystemHealthTest, TestHealthMonitorNotifiesOffline)
+{
+    using namespace std::chrono_literals;
+    std::future<void> offline_future;
+    TestHealthMonitor health_monitor(offline_future, _participant_name);
+    _system.setHealthMonitoringBatchInterval(50ms);
+    ASSERT_EQ(_system.getHealthMonitoringBatchInterval(), 50ms);
+    _system.registerHealthMonitoring(health_monitor);
+
+    // no polling, the monitor is called once the participant is detected offline
+    _participants[_participant_name]->_part_executor.shutdown();
+    _system.setLivelinessTimeout(10ns);
+    ASSERT_EQ(offline_future.wait_for(10s), std::future_status::ready);
+
+    _system.unregisterHealthMonitoring(health_monitor);
+}
+
+TEST_F(SystemHealthTest, TestParticipantHealthHistory)
+{
+    using namespace std::chrono_literals;
+    ASSERT_EQ(_system.getHealthHistoryCapacity(), 0);
+    _system.setHealthHistoryCapacity(5);
+    ASSERT_EQ(_system.getHealthHistoryCapacity(), 5);
+    _system.setHeartbeatInterval({}, 100ms);
+
+    // more heartbeats than the capacity
+    std::this_thread::sleep_for(2s);
+
+    const auto samples = _system.getParticipantHealthHistory(_participant_name, 10s);
+    ASSERT_GE(samples.size(), 2);
+    ASSERT_LE(samples.size(), 5);
+    ASSERT_LT(samples.front().system_time, samples.back().system_time);
+
+    const auto rates = _system.getParticipantHealthRates(_participant_name, 10s);
+    ASSERT_EQ(rates.sample_count, samples.size());
+    ASSERT_GT(rates.mean_heartbeat_interval.count(), 0);
+    // the participant is not running
+    ASSERT_EQ(rates.simulation_time_per_second, 0.0);
+    ASSERT_EQ(rates.errors_per_second, 0.0);
+
+    ASSERT_THROW(_system.getParticipantHealthHistory("unknown_participant", 10s), std::runtime_error);
+}
+
+TEST_F(SystemHealthTest, TestSimulationProgress)
+{
+    using namespace std::chrono_literals;
+    _system.setHeartbeatInterval({}, 100ms);
+    std::this_thread::sleep_for(1s);
+
+    const auto progress = _system.getSimulationProgress();
+    ASSERT_LE(progress.participants.size(), 1);
+    for (const auto& [participant_name, participant_progress] : progress.participants)
+    {
+        ASSERT_EQ(participant_name, _participant_name);
+        // the only participant is not running
+        ASSERT_EQ(participant_progress.real_time_factor, 0.0);
+        ASSERT_EQ(participant_progress.lag, 0ns);
+    }
+    ASSERT_EQ(progress.max_lag, 0ns);
+    ASSERT_EQ(progress.mean_real_time_factor, 0.0);
+}
+
 TEST_F(SystemHealthTest, TestParticpantGetSetLivelinessTimeout)
 {
     using namespace std::chrono_literals;
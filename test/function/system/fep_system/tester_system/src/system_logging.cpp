@@ -148,3 +148,202 @@ TEST(SystemLibrary, TestEaryEventMonitorRegister)
 
     ASSERT_TRUE(logEntriesContainString(test_log._messages[fep3::LoggerSeverity::warning], expected_log_content));
 }
+
+TEST(SystemLibrary, TestAsyncLogging)
+{
+    auto sys_name = makePlatformDepName("test_system");
+    const auto participant_names = std::vector<std::string>{"test_participant1", "test_participant2"};
+    const TestParticipants test_parts = createTestParticipants(participant_names, sys_name);
+
+    using namespace std::literals::chrono_literals;
+
+    fep3::System my_system = fep3::discoverSystem(sys_name, participant_names, 10000ms);
+    EXPECT_FALSE(my_system.getAsyncLogging()._enabled);
+
+    fep3::AsyncLoggingConfig config;
+    config._enabled = true;
+    config._queue_capacity = 4;
+    config._overflow_policy = fep3::LogOverflowPolicy::block;
+    my_system.setAsyncLogging(config);
+    EXPECT_TRUE(my_system.getAsyncLogging()._enabled);
+    EXPECT_EQ(my_system.getAsyncLogging()._overflow_policy, fep3::LogOverflowPolicy::block);
+
+    TestEventMonLog test_log;
+    my_system.registerMonitoring(test_log);
+
+    my_system.load();
+    my_system.initialize();
+
+    int try_count = 20;
+    while (test_log._logcount < 16 && try_count > 0)
+    {
+        a_util::system::sleepMilliseconds(200);
+        try_count--;
+    }
+    // delivers the queued records before switching back
+    config._enabled = false;
+    my_system.setAsyncLogging(config);
+    my_system.unregisterMonitoring(test_log);
+
+    // nothing is dropped if the logging blocks
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::info].size(), 4);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::warning].size(), 4);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::error].size(), 4);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::fatal].size(), 4);
+
+    const auto metrics = my_system.getLoggingMetrics();
+    EXPECT_GE(metrics._delivered, 16u);
+    EXPECT_EQ(metrics._dropped, 0u);
+    EXPECT_EQ(metrics._queued, 0u);
+}
+
+TEST(SystemLibrary, TestMultipleFilteredEventMonitors)
+{
+    auto sys_name = makePlatformDepName("test_system");
+    const auto participant_names = std::vector<std::string>{"test_participant1", "test_participant2"};
+    const TestParticipants test_parts = createTestParticipants(participant_names, sys_name);
+
+    using namespace std::literals::chrono_literals;
+
+    fep3::System my_system = fep3::discoverSystem(sys_name, participant_names, 10000ms);
+    TestEventMonLog test_log_all;
+    TestEventMonLog test_log_filtered;
+    my_system.registerMonitoring(test_log_all);
+    my_system.registerMonitoring(test_log_filtered, { fep3::LoggerSeverity::warning, { "test_participant1" }, "Testelement" });
+
+    my_system.load();
+    my_system.initialize();
+
+    int try_count = 20;
+    while ((test_log_all._logcount < 16 || test_log_filtered._logcount < 6) && try_count > 0)
+    {
+        a_util::system::sleepMilliseconds(200);
+        try_count--;
+    }
+    // the other monitor stays registered
+    my_system.unregisterMonitoring(test_log_all);
+    my_system.deinitialize();
+    my_system.unregisterMonitoring(test_log_filtered);
+
+    EXPECT_EQ(test_log_all._messages[fep3::LoggerSeverity::info].size(), 4);
+    EXPECT_EQ(test_log_all._messages[fep3::LoggerSeverity::fatal].size(), 4);
+
+    EXPECT_EQ(test_log_filtered._messages[fep3::LoggerSeverity::info].size(), 0);
+    EXPECT_GE(test_log_filtered._messages[fep3::LoggerSeverity::warning].size(), 2);
+    EXPECT_GE(test_log_filtered._messages[fep3::LoggerSeverity::error].size(), 2);
+    EXPECT_GE(test_log_filtered._messages[fep3::LoggerSeverity::fatal].size(), 2);
+    for (const auto& [severity, messages] : test_log_filtered._messages)
+    {
+        EXPECT_TRUE(logEntriesContainString(messages, { "test_participant1" }));
+    }
+}
+
+TEST(SystemLibrary, TestSeverityLevel)
+{
+    auto sys_name = makePlatformDepName("test_system");
+    const auto participant_names = std::vector<std::string>{"test_participant1", "test_participant2"};
+    const TestParticipants test_parts = createTestParticipants(participant_names, sys_name);
+
+    using namespace std::literals::chrono_literals;
+
+    fep3::System my_system = fep3::discoverSystem(sys_name, participant_names, 10000ms);
+    EXPECT_EQ(my_system.getSeverityLevel(), fep3::LoggerSeverity::info);
+    my_system.setSeverityLevel(fep3::LoggerSeverity::error, true);
+    EXPECT_EQ(my_system.getSeverityLevel(), fep3::LoggerSeverity::error);
+
+    TestEventMonLog test_log;
+    my_system.registerMonitoring(test_log);
+
+    my_system.load();
+    my_system.initialize();
+
+    int try_count = 20;
+    while (test_log._logcount < 8 && try_count > 0)
+    {
+        a_util::system::sleepMilliseconds(200);
+        try_count--;
+    }
+    my_system.unregisterMonitoring(test_log);
+
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::info].size(), 0);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::warning].size(), 0);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::error].size(), 4);
+    EXPECT_EQ(test_log._messages[fep3::LoggerSeverity::fatal].size(), 4);
+
+    // the participants filter at the source as well
+    for (const auto& participant_name : participant_names)
+    {
+        auto logging_service = my_system.getParticipant(participant_name).getRPCComponentProxyByIID<fep3::rpc::IRPCLoggingService>();
+        ASSERT_TRUE(logging_service);
+        EXPECT_EQ(logging_service->getLoggerFilter("")._severity, fep3::LoggerSeverity::error);
+    }
+}
+
+TEST(SystemLibrary, TestLogRecordTimestamps)
+{
+    struct RecordMonitor : public fep3::IEventMonitor
+    {
+        void onLogRecord(const fep3::LogRecord& record) override
+        {
+            if (record._severity != fep3::LoggerSeverity::fatal)
+            {
+                return;
+            }
+            _timestamps.push_back(record._timestamp);
+            _logger_names.push_back(record._logger_name);
+        }
+        std::vector<std::chrono::nanoseconds> _timestamps;
+        std::vector<const std::string*> _logger_names;
+    } record_monitor;
+
+    fep3::System my_system(makePlatformDepName("test_system"));
+    my_system.registerMonitoring(record_monitor);
+
+    const auto before = std::chrono::system_clock::now().time_since_epoch();
+    EXPECT_THROW(my_system.getParticipant("not_existing"), std::runtime_error);
+    EXPECT_THROW(my_system.getParticipant("not_existing_either"), std::runtime_error);
+    const auto after = std::chrono::system_clock::now().time_since_epoch();
+    my_system.unregisterMonitoring(record_monitor);
+
+    // the records of the system itself are stamped with the full resolution of the system clock
+    ASSERT_EQ(record_monitor._timestamps.size(), 2u);
+    for (const auto& timestamp : record_monitor._timestamps)
+    {
+        EXPECT_GE(timestamp, before);
+        EXPECT_LE(timestamp, after);
+    }
+    // the logger name is interned
+    EXPECT_EQ(record_monitor._logger_names[0], record_monitor._logger_names[1]);
+    EXPECT_EQ(*record_monitor._logger_names[0], my_system.getSystemName());
+}
+
+TEST(SystemLibrary, TestLogArchive)
+{
+    fep3::System my_system(makePlatformDepName("test_system"));
+    fep3::LogArchiveConfig config;
+    config._directory = "test_system_log_archive";
+    // the segments of former runs are kept, the query selects the records of this run
+    const auto begin = std::chrono::system_clock::now().time_since_epoch();
+    {
+        fep3::LogArchive archive(config);
+        fep3::EventMonitorFilter fatal_only;
+        fatal_only._severity = fep3::LoggerSeverity::fatal;
+        my_system.registerMonitoring(archive, fatal_only);
+
+        EXPECT_THROW(my_system.getParticipant("not_existing"), std::runtime_error);
+        EXPECT_THROW(my_system.getParticipant("not_existing_either"), std::runtime_error);
+        my_system.unregisterMonitoring(archive);
+        EXPECT_EQ(archive.getWrittenCount(), 2u);
+        EXPECT_EQ(archive.getDroppedCount(), 0u);
+    }
+
+    fep3::LogArchiveQuery query;
+    query._begin = begin;
+    query._participant_names = { "" };
+    const auto entries = fep3::LogArchiveReader(config._directory).query(query);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0]._severity, fep3::LoggerSeverity::fatal);
+    EXPECT_EQ(entries[0]._logger_name, my_system.getSystemName());
+    EXPECT_NE(entries[0]._message.find("not_existing"), std::string::npos);
+    EXPECT_NE(entries[1]._message.find("not_existing_either"), std::string::npos);
+}
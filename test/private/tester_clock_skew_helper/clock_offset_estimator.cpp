@@ -0,0 +1,55 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "clock_offset_estimator.h"
+#include <gtest/gtest.h>
+
+using namespace std::literals::chrono_literals;
+
+TEST(ClockOffsetEstimator, usesTheMidpointOfTheShortestRoundTrip)
+{
+    fep3::ClockOffsetEstimator estimator;
+    EXPECT_FALSE(estimator.hasEstimate());
+    EXPECT_EQ(estimator.getOffset(), 0ns);
+
+    // remote clock is 1s ahead, the response of the first sample was delayed
+    estimator.addSample(10ms, 1s + 12ms, 30ms);
+    EXPECT_TRUE(estimator.hasEstimate());
+    EXPECT_EQ(estimator.getOffset(), 1s - 8ms);
+    EXPECT_EQ(estimator.getUncertainty(), 10ms);
+
+    estimator.addSample(40ms, 1s + 42ms, 44ms);
+    estimator.addSample(50ms, 1s + 60ms, 70ms);
+    EXPECT_EQ(estimator.getSampleCount(), 3u);
+    EXPECT_EQ(estimator.getOffset(), 1s);
+    EXPECT_EQ(estimator.getRoundTripTime(), 4ms);
+    EXPECT_EQ(estimator.getUncertainty(), 2ms);
+}
+
+TEST(ClockOffsetEstimator, ignoresInvalidSamples)
+{
+    fep3::ClockOffsetEstimator estimator;
+    estimator.addSample(20ms, 5ms, 10ms);
+    EXPECT_FALSE(estimator.hasEstimate());
+
+    // remote clock behind the local clock
+    estimator.addSample(1s, 0ns, 1s + 2ms);
+    EXPECT_EQ(estimator.getSampleCount(), 1u);
+    EXPECT_EQ(estimator.getOffset(), -1s - 1ms);
+}
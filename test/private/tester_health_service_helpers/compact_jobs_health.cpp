@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "compact_jobs_health.h"
+#include "tester_health_service_helpers_common.h"
+
+using ExecuteStep = fep3::CompactJobsHealth::ExecuteStep;
+
+struct CompactJobsHealthTest : public TesterHealthServiceHelpersCommon
+{
+};
+
+TEST_F(CompactJobsHealthTest, roundTrip)
+{
+    fep3::JobHealthiness data_triggered_job{ _job_name2, fep3::JobHealthiness::DataTriggeredJobInfo{ { "signal_a", "signal_b" } }, 12ns };
+    data_triggered_job.execute_error = { 1, 5ns, { -4, "failed", 42, "job.cpp", "execute" } };
+
+    fep3::CompactJobsHealth jobs_health;
+    jobs_health.assign({ _job_healthiness_1, data_triggered_job });
+    ASSERT_EQ(jobs_health.getJobCount(), 2u);
+
+    const auto jobs_healthiness = jobs_health.toJobsHealthiness();
+    ASSERT_EQ(jobs_healthiness.size(), 2u);
+    ASSERT_NO_FATAL_FAILURE(check_healthiness_equality(jobs_healthiness.at(0), _job_healthiness_1));
+
+    const auto& job = jobs_healthiness.at(1);
+    EXPECT_EQ(job.job_name, _job_name2);
+    EXPECT_EQ(std::get<fep3::JobHealthiness::DataTriggeredJobInfo>(job.job_info).trigger_signals,
+        (std::vector<std::string>{ "signal_a", "signal_b" }));
+    EXPECT_EQ(job.simulation_time, 12ns);
+    ASSERT_NO_FATAL_FAILURE(check_execute_error_equality(job.execute_error, data_triggered_job.execute_error));
+    EXPECT_EQ(job.execute_error.last_error.error_description, "failed");
+    EXPECT_EQ(job.execute_error.last_error.line, 42);
+    EXPECT_EQ(job.execute_error.last_error.file, "job.cpp");
+    EXPECT_EQ(job.execute_error.last_error.function, "execute");
+    EXPECT_EQ(job.execute_data_in_error.error_count, 0u);
+}
+
+TEST_F(CompactJobsHealthTest, incrementalDecoding)
+{
+    fep3::CompactJobsHealth jobs_health;
+    jobs_health.addDataTriggeredJob(_job_name1, 1ns);
+    jobs_health.addTriggerSignal("signal_a");
+    jobs_health.addClockTriggeredJob(_job_name2, _cycle_time, 2ns);
+    jobs_health.setExecuteError(ExecuteStep::data_out, 3, 4ns, -1, "", 7, "file.cpp", "function");
+
+    const auto jobs_healthiness = jobs_health.toJobsHealthiness();
+    ASSERT_EQ(jobs_healthiness.size(), 2u);
+    EXPECT_EQ(std::get<fep3::JobHealthiness::DataTriggeredJobInfo>(jobs_healthiness.at(0).job_info).trigger_signals,
+        std::vector<std::string>{ "signal_a" });
+    EXPECT_EQ(std::get<fep3::JobHealthiness::ClockTriggeredJobInfo>(jobs_healthiness.at(1).job_info).cycle_time, _cycle_time);
+    EXPECT_EQ(jobs_healthiness.at(1).execute_data_out_error.error_count, 3u);
+    EXPECT_EQ(jobs_healthiness.at(1).execute_data_out_error.last_error.file, "file.cpp");
+    EXPECT_EQ(jobs_healthiness.at(1).execute_error.error_count, 0u);
+
+    jobs_health.clear();
+    EXPECT_EQ(jobs_health.getJobCount(), 0u);
+    EXPECT_TRUE(jobs_health.toJobsHealthiness().empty());
+}
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "health_fetch_queue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+class BlockingFetchClient : public fep3::IHealthFetchClient
+{
+public:
+    void fetchHealth() override
+    {
+        if (++_running > 1)
+        {
+            _concurrent = true;
+        }
+        _release.wait();
+        ++_fetch_count;
+        --_running;
+    }
+
+    std::shared_future<void> _release;
+    std::atomic<int> _fetch_count{ 0 };
+    std::atomic<int> _running{ 0 };
+    std::atomic<bool> _concurrent{ false };
+};
+
+class CountingFetchClient : public fep3::IHealthFetchClient
+{
+public:
+    void fetchHealth() override
+    {
+        ++_fetch_count;
+    }
+
+    std::atomic<int> _fetch_count{ 0 };
+};
+
+class ThrowingFetchClient : public fep3::IHealthFetchClient
+{
+public:
+    void fetchHealth() override
+    {
+        ++_fetch_count;
+        throw std::runtime_error("participant not reachable");
+    }
+
+    std::atomic<int> _fetch_count{ 0 };
+};
+
+template<typename Predicate>
+bool waitFor(Predicate predicate)
+{
+    for (int attempt = 0; attempt < 500 && !predicate(); ++attempt)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    return predicate();
+}
+} // namespace
+
+TEST(HealthFetchQueue, coalescesRequestsOfOneClient)
+{
+    std::promise<void> release;
+    BlockingFetchClient client;
+    client._release = release.get_future().share();
+    fep3::HealthFetchQueue queue(2);
+
+    queue.request(&client);
+    ASSERT_TRUE(waitFor([&]() { return client._running == 1; }));
+    // requested while running: queued once again afterwards, never fetched concurrently
+    queue.request(&client);
+    queue.request(&client);
+    queue.request(&client);
+    release.set_value();
+
+    ASSERT_TRUE(waitFor([&]() { return !queue.isBusy(&client); }));
+    EXPECT_EQ(client._fetch_count, 2);
+    EXPECT_FALSE(client._concurrent);
+    const auto metrics = queue.getMetrics();
+    EXPECT_EQ(metrics.requested, 4u);
+    EXPECT_EQ(metrics.coalesced, 2u);
+    EXPECT_EQ(metrics.fetched, 2u);
+    EXPECT_EQ(metrics.pending, 0u);
+}
+
+TEST(HealthFetchQueue, cancelDropsPendingFetches)
+{
+    std::promise<void> release;
+    BlockingFetchClient blocking_client;
+    blocking_client._release = release.get_future().share();
+    CountingFetchClient client;
+    fep3::HealthFetchQueue queue(1);
+
+    queue.request(&blocking_client);
+    ASSERT_TRUE(waitFor([&]() { return blocking_client._running == 1; }));
+    queue.request(&client);
+    EXPECT_EQ(queue.getMetrics().pending, 1u);
+    queue.cancel(&client);
+    release.set_value();
+    queue.cancel(&blocking_client);
+
+    EXPECT_EQ(blocking_client._fetch_count, 1);
+    EXPECT_EQ(client._fetch_count, 0);
+    EXPECT_EQ(queue.getMetrics().dropped, 1u);
+}
+
+TEST(HealthFetchQueue, countsFailedFetchesAndKeepsWorking)
+{
+    ThrowingFetchClient throwing_client;
+    CountingFetchClient client;
+    fep3::HealthFetchQueue queue(1);
+
+    queue.request(&throwing_client);
+    ASSERT_TRUE(waitFor([&]() { return queue.getMetrics().fetched == 1u; }));
+    queue.request(&throwing_client);
+    queue.request(&client);
+    ASSERT_TRUE(waitFor([&]() { return queue.getMetrics().fetched == 3u; }));
+
+    EXPECT_EQ(throwing_client._fetch_count, 2);
+    EXPECT_EQ(client._fetch_count, 1);
+    EXPECT_EQ(queue.getMetrics().failed, 2u);
+    queue.cancel(&throwing_client);
+    queue.cancel(&client);
+}
+
+TEST(HealthFetchQueue, servesClientsInTurnWithinTheRateLimit)
+{
+    std::vector<CountingFetchClient> clients(5);
+    fep3::HealthFetchQueue queue(4);
+    queue.setRateLimit(50);
+    EXPECT_EQ(queue.getRateLimit(), 50u);
+
+    const auto begin = std::chrono::steady_clock::now();
+    for (auto& client : clients)
+    {
+        queue.request(&client);
+    }
+    ASSERT_TRUE(waitFor([&]() { return queue.getMetrics().fetched == clients.size(); }));
+    // 5 fetches with 20ms in between
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, 75ms);
+    for (const auto& client : clients)
+    {
+        EXPECT_EQ(client._fetch_count, 1);
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "health_history.h"
+#include <gtest/gtest.h>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+fep3::CompactJobsHealth makeJobsHealth(std::chrono::nanoseconds simulation_time, uint64_t error_count)
+{
+    fep3::CompactJobsHealth jobs_health;
+    jobs_health.addClockTriggeredJob("job_1", 10ms, simulation_time);
+    jobs_health.setExecuteError(fep3::CompactJobsHealth::ExecuteStep::execute, error_count, simulation_time, -1, "", 0, "", "");
+    jobs_health.addDataTriggeredJob("job_2", simulation_time - 5ms);
+    jobs_health.setExecuteError(fep3::CompactJobsHealth::ExecuteStep::data_out, 1, simulation_time, -1, "", 0, "", "");
+    return jobs_health;
+}
+} // namespace
+
+TEST(HealthHistory, keepsTheLatestSamplesUpToItsCapacity)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::HealthHistory history(3);
+    for (int sample = 0; sample < 5; ++sample)
+    {
+        history.record(start + sample * 100ms, makeJobsHealth(sample * 100ms, sample));
+    }
+    // not later than the latest sample
+    history.record(start + 400ms, makeJobsHealth(1s, 10));
+
+    const auto samples = history.getSamples(start);
+    ASSERT_EQ(samples.size(), 3u);
+    EXPECT_EQ(samples.front().system_time, start + 200ms);
+    EXPECT_EQ(samples.back().system_time, start + 400ms);
+    EXPECT_EQ(samples.back().simulation_time, 400ms);
+    EXPECT_EQ(samples.back().jobs_error_count.at("job_1"), 4u);
+    EXPECT_EQ(samples.back().jobs_error_count.at("job_2"), 1u);
+
+    EXPECT_EQ(history.getSamples(start + 250ms).size(), 2u);
+    EXPECT_TRUE(history.getSamples(start + 1s).empty());
+
+    history.setCapacity(2);
+    EXPECT_EQ(history.getCapacity(), 2u);
+    ASSERT_EQ(history.getSamples(start).size(), 2u);
+    EXPECT_EQ(history.getSamples(start).front().system_time, start + 300ms);
+    history.record(start + 500ms, makeJobsHealth(500ms, 5));
+    EXPECT_EQ(history.getSamples(start).front().system_time, start + 400ms);
+
+    history.setCapacity(0);
+    history.record(start + 600ms, makeJobsHealth(600ms, 6));
+    EXPECT_TRUE(history.getSamples(start).empty());
+}
+
+TEST(HealthHistory, derivesRates)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::HealthHistory history(100);
+    EXPECT_EQ(history.getRates(start).sample_count, 0u);
+
+    // 2 errors and 500 ms simulation time per second, heartbeats every 100 ms +- 10 ms
+    for (int sample = 0; sample <= 10; ++sample)
+    {
+        const auto jitter = (sample % 2 == 0 || sample == 10) ? 0ms : 10ms;
+        history.record(start + sample * 100ms + jitter, makeJobsHealth(sample * 50ms, sample / 5));
+    }
+    auto rates = history.getRates(start);
+    EXPECT_EQ(rates.sample_count, 11u);
+    EXPECT_DOUBLE_EQ(rates.errors_per_second, 2.0);
+    EXPECT_DOUBLE_EQ(rates.simulation_time_per_second, 0.5);
+    EXPECT_EQ(rates.mean_heartbeat_interval, 100ms);
+    EXPECT_EQ(rates.heartbeat_jitter, 10ms);
+
+    // restarted participant, its counters start from zero again: 2 errors within 100 ms
+    history.record(start + 1100ms, makeJobsHealth(20ms, 1));
+    rates = history.getRates(start + 1s);
+    EXPECT_EQ(rates.sample_count, 2u);
+    EXPECT_DOUBLE_EQ(rates.errors_per_second, 20.0);
+    EXPECT_NEAR(rates.simulation_time_per_second, 0.2, 1e-9);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "health_notifier.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+/// reports the participants set by the test as changed once
+class FakeHealthQuery
+{
+public:
+    fep3::ParticipantsHealthChanges query(uint64_t)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        fep3::ParticipantsHealthChanges changes;
+        changes.version = ++_version;
+        std::swap(changes.participants_health, _changed);
+        ++_query_count;
+        return changes;
+    }
+
+    void change(const std::string& participant_name)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        _changed[participant_name] = fep3::ParticipantHealth{ fep3::ParticipantRunningState::online, {} };
+    }
+
+    std::atomic<int> _query_count{ 0 };
+
+private:
+    std::mutex _sync;
+    uint64_t _version = 0;
+    std::map<std::string, fep3::ParticipantHealth> _changed;
+};
+
+class RecordingHealthMonitor : public fep3::IHealthMonitor
+{
+public:
+    void onHealthChanged(const std::map<std::string, fep3::ParticipantHealth>& participants_health) override
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        _calls.push_back(participants_health);
+    }
+
+    std::vector<std::map<std::string, fep3::ParticipantHealth>> getCalls()
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _calls;
+    }
+
+private:
+    std::mutex _sync;
+    std::vector<std::map<std::string, fep3::ParticipantHealth>> _calls;
+};
+
+template<typename Predicate>
+bool waitFor(Predicate predicate)
+{
+    for (int attempt = 0; attempt < 500 && !predicate(); ++attempt)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    return predicate();
+}
+} // namespace
+
+TEST(HealthNotifier, deliversChangesOnHealthUpdate)
+{
+    FakeHealthQuery health;
+    RecordingHealthMonitor monitor;
+    fep3::HealthNotifier notifier([&](uint64_t version) { return health.query(version); });
+    notifier.registerMonitor(&monitor);
+    ASSERT_TRUE(waitFor([&]() { return health._query_count > 0; }));
+
+    health.change("participant");
+    fep3::signalHealthUpdate();
+    ASSERT_TRUE(waitFor([&]() { return monitor.getCalls().size() == 1; }));
+    EXPECT_EQ(monitor.getCalls().front().count("participant"), 1u);
+}
+
+TEST(HealthNotifier, batchesChangesWithinInterval)
+{
+    FakeHealthQuery health;
+    RecordingHealthMonitor monitor;
+    fep3::HealthNotifier notifier([&](uint64_t version) { return health.query(version); });
+    notifier.setBatchInterval(300ms);
+    EXPECT_EQ(notifier.getBatchInterval(), 300ms);
+    notifier.registerMonitor(&monitor);
+    ASSERT_TRUE(waitFor([&]() { return health._query_count > 0; }));
+
+    health.change("participant_1");
+    fep3::signalHealthUpdate();
+    std::this_thread::sleep_for(20ms);
+    health.change("participant_2");
+    fep3::signalHealthUpdate();
+
+    ASSERT_TRUE(waitFor([&]() { return !monitor.getCalls().empty(); }));
+    const auto calls = monitor.getCalls();
+    ASSERT_EQ(calls.size(), 1u);
+    EXPECT_EQ(calls.front().size(), 2u);
+}
+
+TEST(HealthNotifier, noCallbackAfterUnregister)
+{
+    FakeHealthQuery health;
+    RecordingHealthMonitor monitor;
+    fep3::HealthNotifier notifier([&](uint64_t version) { return health.query(version); });
+    notifier.registerMonitor(&monitor);
+    ASSERT_TRUE(waitFor([&]() { return health._query_count > 0; }));
+    notifier.unregisterMonitor(&monitor);
+
+    const int query_count = health._query_count;
+    health.change("participant");
+    fep3::signalHealthUpdate();
+    ASSERT_TRUE(waitFor([&]() { return health._query_count > query_count; }));
+    EXPECT_TRUE(monitor.getCalls().empty());
+}
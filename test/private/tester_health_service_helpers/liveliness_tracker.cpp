@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "liveliness_tracker.h"
+#include <gtest/gtest.h>
+#include <mutex>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+class TransitionRecorder
+{
+public:
+    void record(const std::string& participant_name, fep3::ParticipantRunningState running_state)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        _transitions.emplace_back(participant_name, running_state);
+    }
+
+    std::vector<std::pair<std::string, fep3::ParticipantRunningState>> getTransitions()
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+        return _transitions;
+    }
+
+private:
+    std::mutex _sync;
+    std::vector<std::pair<std::string, fep3::ParticipantRunningState>> _transitions;
+};
+
+template<typename Predicate>
+bool waitFor(Predicate predicate)
+{
+    for (int attempt = 0; attempt < 500 && !predicate(); ++attempt)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    return predicate();
+}
+} // namespace
+
+TEST(LivelinessTracker, reportsOnlineAndOfflineTransitions)
+{
+    TransitionRecorder recorder;
+    fep3::LivelinessTracker tracker(100ms,
+        [&](const std::string& participant_name, fep3::ParticipantRunningState running_state)
+        {
+            recorder.record(participant_name, running_state);
+        });
+    tracker.addParticipant("participant");
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::offline);
+
+    tracker.updateEvent({ "participant", "system", "url", fep3::IServiceBus::ServiceUpdateEventType::notify_alive });
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::online);
+    ASSERT_EQ(recorder.getTransitions().size(), 1u);
+    EXPECT_EQ(recorder.getTransitions().back().second, fep3::ParticipantRunningState::online);
+
+    // alive within the timeout keeps it online
+    for (int heartbeat = 0; heartbeat < 5; ++heartbeat)
+    {
+        std::this_thread::sleep_for(30ms);
+        tracker.alive("participant");
+    }
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::online);
+    EXPECT_EQ(recorder.getTransitions().size(), 1u);
+
+    // reported without anybody asking
+    ASSERT_TRUE(waitFor([&]() { return recorder.getTransitions().size() == 2; }));
+    EXPECT_EQ(recorder.getTransitions().back(),
+        std::make_pair(std::string("participant"), fep3::ParticipantRunningState::offline));
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::offline);
+}
+
+TEST(LivelinessTracker, ignoresUnknownAndRemovedParticipants)
+{
+    TransitionRecorder recorder;
+    fep3::LivelinessTracker tracker(10ms,
+        [&](const std::string& participant_name, fep3::ParticipantRunningState running_state)
+        {
+            recorder.record(participant_name, running_state);
+        });
+    tracker.alive("unknown");
+    EXPECT_EQ(tracker.getRunningState("unknown"), fep3::ParticipantRunningState::offline);
+
+    tracker.addParticipant("participant");
+    tracker.alive("participant");
+    tracker.removeParticipant("participant");
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(recorder.getTransitions().size(), 1u);
+}
+
+TEST(LivelinessTracker, reevaluatesOnTimeoutChange)
+{
+    TransitionRecorder recorder;
+    fep3::LivelinessTracker tracker(20s,
+        [&](const std::string& participant_name, fep3::ParticipantRunningState running_state)
+        {
+            recorder.record(participant_name, running_state);
+        });
+    EXPECT_EQ(tracker.getLivelinessTimeout(), 20s);
+    tracker.addParticipant("participant");
+    tracker.alive("participant");
+    std::this_thread::sleep_for(20ms);
+
+    tracker.setLivelinessTimeout(10ns);
+    EXPECT_EQ(tracker.getLivelinessTimeout(), 10ns);
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::offline);
+    EXPECT_EQ(recorder.getTransitions().size(), 2u);
+
+    tracker.setLivelinessTimeout(20s);
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::online);
+    EXPECT_EQ(recorder.getTransitions().size(), 3u);
+}
+
+TEST(LivelinessTracker, addsParticipantsAliveBefore)
+{
+    TransitionRecorder recorder;
+    fep3::LivelinessTracker tracker(50ms,
+        [&](const std::string& participant_name, fep3::ParticipantRunningState running_state)
+        {
+            recorder.record(participant_name, running_state);
+        });
+    tracker.addParticipant("participant", std::chrono::steady_clock::now());
+    EXPECT_EQ(tracker.getRunningState("participant"), fep3::ParticipantRunningState::online);
+    tracker.addParticipant("silent_participant", std::chrono::steady_clock::now() - 1s);
+    EXPECT_EQ(tracker.getRunningState("silent_participant"), fep3::ParticipantRunningState::offline);
+
+    ASSERT_TRUE(waitFor([&]() { return recorder.getTransitions().size() == 1; }));
+    EXPECT_EQ(recorder.getTransitions().back(),
+        std::make_pair(std::string("participant"), fep3::ParticipantRunningState::offline));
+}
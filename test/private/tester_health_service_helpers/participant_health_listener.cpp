@@ -117,3 +117,65 @@ TEST_F(ParticipantHealthListenerTest, deactivateLogging)
 
     ASSERT_FALSE(_logging_called);
 }
+
+TEST_F(ParticipantHealthListenerTest, updateEventFetchesAsynchronously)
+{
+    auto fetch_queue = std::make_shared<fep3::HealthFetchQueue>(1);
+    fep3::ParticipantHealthListener health_listener{ &_rpc_health_service_mock, _participant_name, _system_name,
+        [&](fep3::LoggerSeverity, const std::string&) {onLog(); }, fetch_queue };
+    EXPECT_CALL(_rpc_health_service_mock, getHealth()).WillRepeatedly(Return(_jobs_healthiness));
+
+    health_listener.updateEvent(
+        fep3::IServiceBus::ServiceUpdateEvent{
+            _participant_name ,
+            _system_name,
+            "url",
+            fep3::IServiceBus::ServiceUpdateEventType::notify_alive });
+
+    for (int attempt = 0; attempt < 100 && fetch_queue->isBusy(&health_listener); ++attempt)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    auto participant_health = health_listener.getParticipantHealth();
+
+    ASSERT_EQ(participant_health.jobs_healthiness.size(), 2);
+    ASSERT_NO_FATAL_FAILURE(check_healthiness_equality(participant_health.jobs_healthiness.at(0), _job_healthiness_1));
+    EXPECT_EQ(fetch_queue->getMetrics().fetched, 1u);
+}
+
+TEST_F(ParticipantHealthListenerTest, publishesVersionedSnapshots)
+{
+    EXPECT_CALL(_rpc_health_service_mock, getHealth())
+        .WillOnce(Return(_jobs_healthiness))
+        .WillOnce(Return(_jobs_healthiness))
+        .WillOnce(Return(std::vector<fep3::JobHealthiness>{ _job_healthiness_1 }));
+    const auto alive_event = fep3::IServiceBus::ServiceUpdateEvent{
+        _participant_name ,
+        _system_name,
+        "url",
+        fep3::IServiceBus::ServiceUpdateEventType::notify_alive };
+
+    const auto initial_snapshot = _health_listener.getHealthSnapshot();
+    EXPECT_EQ(initial_snapshot->version, 0u);
+
+    _health_listener.updateEvent(alive_event);
+    const auto first_snapshot = _health_listener.getHealthSnapshot();
+    EXPECT_GT(first_snapshot->version, 0u);
+    // published snapshots are never changed
+    EXPECT_EQ(initial_snapshot->version, 0u);
+    EXPECT_EQ(initial_snapshot->jobs_health->getJobCount(), 0u);
+
+    // unchanged health keeps the version, but the alive time is updated
+    _health_listener.updateEvent(alive_event);
+    const auto second_snapshot = _health_listener.getHealthSnapshot();
+    EXPECT_EQ(second_snapshot->version, first_snapshot->version);
+    EXPECT_GE(second_snapshot->system_time, first_snapshot->system_time);
+    EXPECT_TRUE(_health_listener.getParticipantHealthSince(first_snapshot->version).jobs_healthiness.empty());
+
+    _health_listener.updateEvent(alive_event);
+    const auto third_snapshot = _health_listener.getHealthSnapshot();
+    EXPECT_GT(third_snapshot->version, second_snapshot->version);
+    const auto participant_health = _health_listener.getParticipantHealthSince(first_snapshot->version);
+    EXPECT_EQ(participant_health.version, third_snapshot->version);
+    ASSERT_EQ(participant_health.jobs_healthiness.size(), 1);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "service_update_dispatcher.h"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace ::testing;
+
+class ServiceUpdateEventSinkMock : public fep3::IServiceBus::IServiceUpdateEventSink
+{
+public:
+    MOCK_METHOD(void, updateEvent, (const fep3::IServiceBus::ServiceUpdateEvent&), (override));
+};
+
+struct ServiceUpdateDispatcherTest : public testing::Test
+{
+    fep3::IServiceBus::ServiceUpdateEvent makeEvent(const std::string& participant_name, const std::string& system_name)
+    {
+        return fep3::IServiceBus::ServiceUpdateEvent{
+            participant_name,
+            system_name,
+            "url",
+            fep3::IServiceBus::ServiceUpdateEventType::notify_alive };
+    }
+
+    fep3::ServiceUpdateDispatcher _dispatcher;
+    StrictMock<ServiceUpdateEventSinkMock> _sink_1;
+    StrictMock<ServiceUpdateEventSinkMock> _sink_2;
+    StrictMock<ServiceUpdateEventSinkMock> _sink_3;
+    const std::string _system_name = "system_name";
+};
+
+TEST_F(ServiceUpdateDispatcherTest, forwardsEventsOnlyToTheirParticipant)
+{
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_1);
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_2);
+    _dispatcher.registerSink(_system_name, "participant_2", &_sink_3);
+    // registering twice has no effect
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_1);
+
+    EXPECT_CALL(_sink_1, updateEvent(Field(&fep3::IServiceBus::ServiceUpdateEvent::service_name, "participant_1"))).Times(1);
+    EXPECT_CALL(_sink_2, updateEvent(Field(&fep3::IServiceBus::ServiceUpdateEvent::service_name, "participant_1"))).Times(1);
+    _dispatcher.updateEvent(makeEvent("participant_1", _system_name));
+
+    // no sink for another system or an unknown participant
+    _dispatcher.updateEvent(makeEvent("participant_2", "another_system"));
+    _dispatcher.updateEvent(makeEvent("participant_3", _system_name));
+}
+
+TEST_F(ServiceUpdateDispatcherTest, deregisteredSinksAreNotCalled)
+{
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_1);
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_2);
+    _dispatcher.deregisterSink(_system_name, "participant_1", &_sink_1);
+    // deregistering unknown sinks has no effect
+    _dispatcher.deregisterSink(_system_name, "participant_2", &_sink_1);
+    _dispatcher.deregisterSink("another_system", "participant_1", &_sink_2);
+
+    EXPECT_CALL(_sink_2, updateEvent(_)).Times(1);
+    _dispatcher.updateEvent(makeEvent("participant_1", _system_name));
+
+    _dispatcher.deregisterSink(_system_name, "participant_1", &_sink_2);
+    _dispatcher.updateEvent(makeEvent("participant_1", _system_name));
+}
+
+TEST_F(ServiceUpdateDispatcherTest, sinksMayRegisterAndDeregisterSinksWhileCalled)
+{
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_1);
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_2);
+
+    // e.g. a participant proxy created and another one destroyed from within a callback
+    EXPECT_CALL(_sink_1, updateEvent(_)).WillOnce(InvokeWithoutArgs([this]()
+        {
+            _dispatcher.registerSink(_system_name, "participant_2", &_sink_3);
+            _dispatcher.deregisterSink(_system_name, "participant_1", &_sink_2);
+            _dispatcher.deregisterSink(_system_name, "participant_1", &_sink_1);
+        }));
+    // _sink_2 is not called after its deregistration, although the delivery copied it before
+    _dispatcher.updateEvent(makeEvent("participant_1", _system_name));
+
+    EXPECT_CALL(_sink_3, updateEvent(_)).Times(1);
+    _dispatcher.updateEvent(makeEvent("participant_1", _system_name));
+    _dispatcher.updateEvent(makeEvent("participant_2", _system_name));
+}
+
+TEST_F(ServiceUpdateDispatcherTest, deregisteringWaitsForARunningDelivery)
+{
+    std::promise<void> entered;
+    std::atomic<bool> left{ false };
+    _dispatcher.registerSink(_system_name, "participant_1", &_sink_1);
+    EXPECT_CALL(_sink_1, updateEvent(_)).WillOnce(InvokeWithoutArgs([&]()
+        {
+            entered.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            left = true;
+        }));
+
+    std::thread delivering([&]() { _dispatcher.updateEvent(makeEvent("participant_1", _system_name)); });
+    entered.get_future().wait();
+    _dispatcher.deregisterSink(_system_name, "participant_1", &_sink_1);
+    EXPECT_TRUE(left);
+    delivering.join();
+}
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "simulation_progress_monitor.h"
+#include <gtest/gtest.h>
+
+using namespace std::literals::chrono_literals;
+
+TEST(SimulationProgressMonitor, derivesRealTimeFactorAndLag)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::SimulationProgressMonitor monitor;
+
+    fep3::CompactJobsHealth jobs_health;
+    jobs_health.addClockTriggeredJob("job_1", 10ms, 100ms);
+    jobs_health.addDataTriggeredJob("job_2", 300ms);
+    monitor.update("part_1", start, jobs_health);
+    // participants without jobs do not report a simulation time
+    monitor.update("part_no_jobs", start, fep3::CompactJobsHealth{});
+    monitor.update("part_2", start, 0ms);
+
+    auto progress = monitor.getProgress();
+    ASSERT_EQ(progress.participants.size(), 2u);
+    EXPECT_EQ(progress.participants.at("part_1").simulation_time, 300ms);
+    EXPECT_EQ(progress.participants.at("part_1").real_time_factor, 0.0);
+    EXPECT_EQ(progress.participants.at("part_1").lag, 0ms);
+    EXPECT_EQ(progress.participants.at("part_2").lag, 300ms);
+    EXPECT_EQ(progress.max_lag, 300ms);
+    EXPECT_EQ(progress.mean_lag, 150ms);
+
+    monitor.update("part_1", start + 1s, 1300ms);
+    monitor.update("part_2", start + 1s, 500ms);
+    progress = monitor.getProgress();
+    EXPECT_DOUBLE_EQ(progress.participants.at("part_1").real_time_factor, 1.0);
+    EXPECT_DOUBLE_EQ(progress.participants.at("part_2").real_time_factor, 0.5);
+    EXPECT_EQ(progress.participants.at("part_2").lag, 800ms);
+    EXPECT_DOUBLE_EQ(progress.min_real_time_factor, 0.5);
+    EXPECT_DOUBLE_EQ(progress.max_real_time_factor, 1.0);
+    EXPECT_DOUBLE_EQ(progress.mean_real_time_factor, 0.75);
+    EXPECT_EQ(progress.min_lag, 0ms);
+    EXPECT_EQ(progress.max_lag, 800ms);
+    EXPECT_EQ(progress.mean_lag, 400ms);
+
+    // smoothed towards the latest real time factor
+    monitor.update("part_2", start + 2s, 2500ms);
+    EXPECT_DOUBLE_EQ(monitor.getProgress().participants.at("part_2").real_time_factor, 0.5 + 0.25 * 1.5);
+
+    // a restarted simulation resets the real time factor
+    monitor.update("part_2", start + 3s, 0ms);
+    progress = monitor.getProgress();
+    EXPECT_EQ(progress.participants.at("part_2").real_time_factor, 0.0);
+    EXPECT_DOUBLE_EQ(progress.mean_real_time_factor, 1.0);
+
+    monitor.removeParticipant("part_1");
+    progress = monitor.getProgress();
+    ASSERT_EQ(progress.participants.size(), 1u);
+    EXPECT_EQ(progress.max_lag, 0ms);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "timer_wheel.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+using namespace std::literals::chrono_literals;
+
+TEST(TimerWheel, expiresTimersInOrder)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::TimerWheel wheel(1ms, start);
+    wheel.schedule("late", start + 5s);
+    wheel.schedule("early", start + 10ms);
+    wheel.schedule("middle", start + 300ms);
+    EXPECT_EQ(wheel.size(), 3u);
+    EXPECT_EQ(wheel.getNextAdvanceTime(), start + 10ms);
+
+    EXPECT_TRUE(wheel.advance(start + 9ms).empty());
+    EXPECT_EQ(wheel.advance(start + 10ms), std::vector<std::string>{ "early" });
+    EXPECT_TRUE(wheel.advance(start + 299ms).empty());
+    EXPECT_EQ(wheel.advance(start + 4s), std::vector<std::string>{ "middle" });
+    EXPECT_EQ(wheel.advance(start + 5s), std::vector<std::string>{ "late" });
+    EXPECT_EQ(wheel.size(), 0u);
+    EXPECT_FALSE(wheel.getNextAdvanceTime());
+}
+
+TEST(TimerWheel, rescheduleAndCancel)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::TimerWheel wheel(1ms, start);
+    wheel.schedule("participant", start + 10ms);
+    wheel.schedule("participant", start + 20s);
+    EXPECT_EQ(wheel.size(), 1u);
+    EXPECT_TRUE(wheel.advance(start + 19s).empty());
+    EXPECT_EQ(wheel.advance(start + 20s), std::vector<std::string>{ "participant" });
+
+    wheel.schedule("participant", start + 30s);
+    EXPECT_TRUE(wheel.cancel("participant"));
+    EXPECT_FALSE(wheel.cancel("participant"));
+    EXPECT_TRUE(wheel.advance(start + 31s).empty());
+}
+
+TEST(TimerWheel, expiresManyTimersAtTheirTick)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::TimerWheel wheel(1ms, start);
+    // spread over all levels, up to 16 million ticks ahead
+    for (int timer = 1; timer <= 2000; ++timer)
+    {
+        wheel.schedule(std::to_string(timer), start + std::chrono::milliseconds(timer * timer * 4));
+    }
+
+    std::vector<std::string> expired;
+    for (auto now = start; wheel.size() > 0; now = *wheel.getNextAdvanceTime())
+    {
+        for (const auto& name : wheel.advance(now))
+        {
+            const auto timer = std::stoi(name);
+            EXPECT_EQ(now, start + std::chrono::milliseconds(timer * timer * 4)) << name;
+            expired.push_back(name);
+        }
+    }
+    EXPECT_EQ(expired.size(), 2000u);
+}
+
+TEST(TimerWheel, expiresTimersBeyondItsRangeEarly)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fep3::TimerWheel wheel(1ns, start);
+    wheel.schedule("far", start + 24h);
+    const auto expired = wheel.advance(start + 1s);
+    EXPECT_EQ(expired, std::vector<std::string>{ "far" });
+}
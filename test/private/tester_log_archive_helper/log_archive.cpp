@@ -0,0 +1,203 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_archive_format.h"
+#include "log_archive_query.h"
+#include "log_archive_writer.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+/// the directory below the working directory, the files of former runs are removed
+std::string makeEmptyDirectory(const std::string& name)
+{
+    fep3::createDirectories(name);
+    for (const auto& file_name : fep3::listFileNames(name))
+    {
+        std::remove(fep3::joinPath(name, file_name).c_str());
+    }
+    return name;
+}
+
+bool append(fep3::LogArchiveWriter& writer,
+    std::chrono::nanoseconds timestamp,
+    fep3::LoggerSeverity severity,
+    const std::string& participant_name,
+    const std::string& message)
+{
+    static const std::string logger_name = "element.logger";
+    return writer.append({ timestamp, severity, &participant_name, &logger_name, message });
+}
+
+std::vector<std::string> query(const std::string& directory, const fep3::LogArchiveQuery& query = {})
+{
+    std::vector<std::string> messages;
+    fep3::queryLogArchive(directory, query, [&messages](const fep3::LogArchiveEntry& entry) {
+        messages.push_back(entry._message);
+        return true;
+    });
+    return messages;
+}
+
+size_t countFiles(const std::string& directory, const std::string& extension)
+{
+    size_t count = 0;
+    for (const auto& file_name : fep3::listFileNames(directory))
+    {
+        count += file_name.size() > extension.size()
+            && file_name.compare(file_name.size() - extension.size(), extension.size(), extension) == 0;
+    }
+    return count;
+}
+} // namespace
+
+TEST(LogArchive, queriesByTimeParticipantAndSeverity)
+{
+    const auto directory = makeEmptyDirectory("queries_by_time_participant_and_severity");
+    {
+        fep3::LogArchiveWriter writer({ directory, 1024 * 1024, 0 });
+        for (int record = 0; record < 1000; ++record)
+        {
+            ASSERT_TRUE(append(writer,
+                std::chrono::seconds(record),
+                record % 10 == 0 ? fep3::LoggerSeverity::error : fep3::LoggerSeverity::debug,
+                record % 2 == 0 ? "participant_1" : "participant_2",
+                std::to_string(record)));
+        }
+        ASSERT_TRUE(append(writer, 1000s, fep3::LoggerSeverity::info, "", "system"));
+    }
+    EXPECT_EQ(countFiles(directory, fep3::log_archive::index_file_extension), 1u);
+
+    EXPECT_EQ(query(directory).size(), 1001u);
+
+    fep3::LogArchiveQuery time_range;
+    time_range._begin = 500s;
+    time_range._end = 503s;
+    EXPECT_EQ(query(directory, time_range), (std::vector<std::string>{ "500", "501", "502" }));
+
+    fep3::LogArchiveQuery errors_of_participant_2;
+    errors_of_participant_2._severity = fep3::LoggerSeverity::error;
+    errors_of_participant_2._participant_names = { "participant_2" };
+    EXPECT_TRUE(query(directory, errors_of_participant_2).empty());
+    errors_of_participant_2._participant_names = { "participant_2", "" };
+    errors_of_participant_2._severity = fep3::LoggerSeverity::info;
+    EXPECT_EQ(query(directory, errors_of_participant_2), (std::vector<std::string>{ "system" }));
+
+    fep3::LogArchiveQuery errors_of_participant_1;
+    errors_of_participant_1._severity = fep3::LoggerSeverity::warning;
+    errors_of_participant_1._participant_names = { "participant_1" };
+    errors_of_participant_1._begin = 900s;
+    EXPECT_EQ(query(directory, errors_of_participant_1).size(), 10u);
+
+    fep3::LogArchiveEntry last_entry;
+    const auto count = fep3::queryLogArchive(directory, {}, [&last_entry](const fep3::LogArchiveEntry& entry) {
+        last_entry = entry;
+        return entry._message != "9";
+    });
+    EXPECT_EQ(count, 10u);
+    EXPECT_EQ(last_entry._timestamp, 9s);
+    EXPECT_EQ(last_entry._severity, fep3::LoggerSeverity::debug);
+    EXPECT_EQ(last_entry._participant_name, "participant_2");
+    EXPECT_EQ(last_entry._logger_name, "element.logger");
+}
+
+TEST(LogArchive, readsTheSegmentWhileItIsWritten)
+{
+    const auto directory = makeEmptyDirectory("reads_the_segment_while_it_is_written");
+    fep3::LogArchiveWriter writer({ directory, 1024 * 1024, 0 });
+    EXPECT_TRUE(query(directory).empty());
+    ASSERT_TRUE(append(writer, 1s, fep3::LoggerSeverity::info, "participant", "first"));
+    ASSERT_TRUE(append(writer, 2s, fep3::LoggerSeverity::info, "participant", "second"));
+    EXPECT_EQ(countFiles(directory, fep3::log_archive::index_file_extension), 0u);
+    EXPECT_EQ(query(directory), (std::vector<std::string>{ "first", "second" }));
+}
+
+TEST(LogArchive, rotatesTheSegmentsAndRemovesTheOldest)
+{
+    const auto directory = makeEmptyDirectory("rotates_the_segments_and_removes_the_oldest");
+    const std::string message(200, 'x');
+    {
+        fep3::LogArchiveWriter writer({ directory, fep3::LogArchiveWriter::min_segment_size, 3 });
+        for (int record = 0; record < 1000; ++record)
+        {
+            ASSERT_TRUE(append(writer, std::chrono::seconds(record), fep3::LoggerSeverity::info, "participant",
+                std::to_string(record) + message));
+        }
+        EXPECT_GT(writer.getSegmentSequence(), 3u);
+    }
+    EXPECT_EQ(countFiles(directory, fep3::log_archive::segment_file_extension), 3u);
+    EXPECT_EQ(countFiles(directory, fep3::log_archive::index_file_extension), 3u);
+    const auto messages = query(directory);
+    ASSERT_FALSE(messages.empty());
+    EXPECT_LT(messages.size(), 1000u);
+    EXPECT_EQ(messages.back(), "999" + message);
+    // the records are in the order they were appended
+    EXPECT_EQ(messages.front(), std::to_string(1000 - messages.size()) + message);
+
+    // a new writer continues after the existing segments
+    uint64_t last_sequence = 0;
+    for (const auto& file_name : fep3::listFileNames(directory))
+    {
+        last_sequence = std::max(last_sequence, fep3::log_archive::parseSegmentSequence(file_name));
+    }
+    fep3::LogArchiveWriter writer({ directory, fep3::LogArchiveWriter::min_segment_size, 0 });
+    EXPECT_EQ(writer.getSegmentSequence(), last_sequence + 1);
+}
+
+TEST(LogArchive, truncatesMessagesExceedingASegment)
+{
+    const auto directory = makeEmptyDirectory("truncates_messages_exceeding_a_segment");
+    {
+        fep3::LogArchiveWriter writer({ directory, 100, 0 });
+        ASSERT_TRUE(append(writer, 1s, fep3::LoggerSeverity::info, "participant", "first"));
+        ASSERT_TRUE(append(writer, 2s, fep3::LoggerSeverity::info, "participant",
+            std::string(2 * fep3::LogArchiveWriter::min_segment_size, 'x')));
+        ASSERT_FALSE(append(writer, 3s, fep3::LoggerSeverity::info,
+            std::string(2 * fep3::LogArchiveWriter::min_segment_size, 'p'), "dropped"));
+    }
+    const auto messages = query(directory);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0], "first");
+    EXPECT_GT(messages[1].size(), fep3::LogArchiveWriter::min_segment_size / 2);
+    EXPECT_LT(messages[1].size(), fep3::LogArchiveWriter::min_segment_size);
+}
+
+TEST(LogArchive, readsTheSegmentWithoutAValidIndex)
+{
+    const auto directory = makeEmptyDirectory("reads_the_segment_without_a_valid_index");
+    {
+        fep3::LogArchiveWriter writer({ directory, 1024 * 1024, 0 });
+        for (int record = 0; record < 600; ++record)
+        {
+            ASSERT_TRUE(append(writer, std::chrono::seconds(record), fep3::LoggerSeverity::info,
+                "participant_" + std::to_string(record % 100), std::to_string(record)));
+        }
+    }
+    std::ofstream(fep3::joinPath(directory, fep3::log_archive::getIndexFileName(1)), std::ios::binary | std::ios::trunc)
+        << "no index";
+    fep3::LogArchiveQuery participant_99;
+    participant_99._participant_names = { "participant_99" };
+    EXPECT_EQ(query(directory, participant_99), (std::vector<std::string>{ "99", "199", "299", "399", "499", "599" }));
+}
@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "property_mirror.h"
+#include <gtest/gtest.h>
+
+using fep3::PropertyMirror;
+using fep3::PropertyPath;
+
+namespace
+{
+PropertyPath path(const std::string& path)
+{
+    return *PropertyPath::parse(path);
+}
+} // namespace
+
+TEST(PropertyMirror, FindsParticipantsByValue)
+{
+    PropertyMirror mirror;
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "local_system_simtime" } });
+    mirror.setParticipant("part_2", { { "clock/main_clock", "string", "local_system_realtime" } });
+    mirror.setParticipant("part_3", { { "clock/main_clock", "string", "local_system_simtime" } });
+
+    EXPECT_TRUE(mirror.containsParticipant("part_1"));
+    EXPECT_FALSE(mirror.containsParticipant("part_4"));
+    EXPECT_EQ(mirror.findParticipants(path("clock/main_clock"), "local_system_simtime"),
+        (std::vector<std::string>{ "part_1", "part_3" }));
+    EXPECT_TRUE(mirror.findParticipants(path("clock/main_clock"), "unknown").empty());
+    EXPECT_TRUE(mirror.findParticipants(path("clock/unknown"), "local_system_simtime").empty());
+    EXPECT_EQ(*mirror.getValue("part_2", path("/clock/main_clock")), "local_system_realtime");
+    EXPECT_FALSE(mirror.getValue("part_4", path("clock/main_clock")));
+}
+
+TEST(PropertyMirror, QueriesWildcardPatterns)
+{
+    PropertyMirror mirror;
+    mirror.setParticipant("part_1", {
+        { "job_registry/jobs/job_a/cycle_sim_time", "int64", "100" },
+        { "job_registry/jobs/job_b/cycle_sim_time", "int64", "200" },
+        { "job_registry/jobs/job_b/delay_sim_time", "int64", "0" } });
+    mirror.setParticipant("part_2", { { "job_registry/jobs/job_c/cycle_sim_time", "int64", "100" } });
+
+    const auto results = mirror.query("job_registry/jobs/*/cycle_sim_time");
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results.at("part_1"), (PropertyMirror::Values{
+        { "job_registry/jobs/job_a/cycle_sim_time", "100" },
+        { "job_registry/jobs/job_b/cycle_sim_time", "200" } }));
+    EXPECT_EQ(results.at("part_2"), (PropertyMirror::Values{ { "job_registry/jobs/job_c/cycle_sim_time", "100" } }));
+
+    EXPECT_EQ(mirror.query("/job_registry/jobs/job_b/*").at("part_1").size(), 2u);
+    EXPECT_TRUE(mirror.query("job_registry/jobs/a b").empty());
+    EXPECT_TRUE(mirror.query("").empty());
+    // segments of a pattern are not interned
+    EXPECT_TRUE(mirror.query("job_registry/never_parsed_segment_of_a_pattern").empty());
+    EXPECT_EQ(PropertyPath::findSegment("never_parsed_segment_of_a_pattern"), nullptr);
+    EXPECT_EQ(PropertyPath::findSegment("job_registry"), &path("job_registry").segment(0));
+}
+
+TEST(PropertyMirror, KeepsValuesCurrent)
+{
+    PropertyMirror mirror;
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "a" }, { "clock/time_factor", "double", "1.0" } });
+
+    EXPECT_TRUE(mirror.updateValue("part_1", path("clock/main_clock"), "b"));
+    EXPECT_FALSE(mirror.updateValue("part_1", path("clock/unknown"), "b"));
+    EXPECT_FALSE(mirror.updateValue("part_2", path("clock/main_clock"), "b"));
+    EXPECT_EQ(*mirror.getValue("part_1", path("clock/main_clock")), "b");
+    EXPECT_TRUE(mirror.findParticipants(path("clock/main_clock"), "a").empty());
+
+    // a new fetch replaces all properties of the participant
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "c" } });
+    EXPECT_EQ(*mirror.getValue("part_1", path("clock/main_clock")), "c");
+    EXPECT_FALSE(mirror.getValue("part_1", path("clock/time_factor")));
+
+    mirror.removeParticipant("part_1");
+    EXPECT_FALSE(mirror.containsParticipant("part_1"));
+    EXPECT_TRUE(mirror.query("clock/*").empty());
+
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "d" } });
+    EXPECT_EQ(mirror.query("clock/*").at("part_1").at("clock/main_clock"), "d");
+    mirror.clear();
+    EXPECT_FALSE(mirror.containsParticipant("part_1"));
+}
+
+TEST(PropertyMirror, ReusesIdsOfRemovedParticipants)
+{
+    PropertyMirror mirror;
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "a" } });
+    mirror.setParticipant("part_2", { { "clock/main_clock", "string", "b" } });
+    // the participants come and go, the ids of the removed ones are taken over
+    for (int round = 0; round < 3; ++round)
+    {
+        mirror.removeParticipant("part_1");
+        mirror.setParticipant("part_" + std::to_string(round + 3), { { "clock/main_clock", "string", "a" } });
+        mirror.setParticipant("part_1", { { "clock/main_clock", "string", "c" } });
+        mirror.removeParticipant("part_" + std::to_string(round + 3));
+    }
+
+    EXPECT_EQ(mirror.findParticipants(path("clock/main_clock"), "a"), std::vector<std::string>{});
+    EXPECT_EQ(mirror.findParticipants(path("clock/main_clock"), "b"), std::vector<std::string>{ "part_2" });
+    EXPECT_EQ(mirror.findParticipants(path("clock/main_clock"), "c"), std::vector<std::string>{ "part_1" });
+    EXPECT_FALSE(mirror.containsParticipant("part_5"));
+    EXPECT_EQ(mirror.query("clock/main_clock").size(), 2u);
+}
+
+TEST(PropertyMirror, RemovesNodesWithoutValues)
+{
+    PropertyMirror mirror;
+    mirror.setParticipant("part_1", {
+        { "clock", "node", "" },
+        { "clock/main_clock", "string", "a" },
+        { "job_registry/jobs/job_a/cycle_sim_time", "int64", "100" } });
+    mirror.setParticipant("part_2", { { "clock/main_clock", "string", "b" } });
+    EXPECT_EQ(mirror.getNodeCount(), 6u);
+
+    // the jobs of part_1 are gone, the clock nodes are still used by both participants
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "c" } });
+    EXPECT_EQ(mirror.getNodeCount(), 2u);
+    EXPECT_TRUE(mirror.query("job_registry/jobs/*/cycle_sim_time").empty());
+
+    mirror.removeParticipant("part_2");
+    EXPECT_EQ(mirror.getNodeCount(), 2u);
+    mirror.removeParticipant("part_1");
+    EXPECT_EQ(mirror.getNodeCount(), 0u);
+
+    // the paths are mirrored again
+    mirror.setParticipant("part_1", { { "clock/main_clock", "string", "d" } });
+    EXPECT_EQ(mirror.getNodeCount(), 2u);
+    EXPECT_EQ(*mirror.getValue("part_1", path("clock/main_clock")), "d");
+    mirror.clear();
+    EXPECT_EQ(mirror.getNodeCount(), 0u);
+}
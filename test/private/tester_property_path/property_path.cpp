@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "property_path.h"
+#include <gtest/gtest.h>
+
+using fep3::PropertyPath;
+
+TEST(PropertyPath, ParsesSlashSeparatedPaths)
+{
+    const auto path = PropertyPath::parse("/clock/main_clock");
+    ASSERT_TRUE(path);
+    ASSERT_EQ(path->size(), 2u);
+    EXPECT_EQ(path->segment(0), "clock");
+    EXPECT_EQ(path->name(), "main_clock");
+    EXPECT_EQ(path->toString(), "/clock/main_clock");
+    EXPECT_EQ(path->toNodeString(), "/clock/main_clock/");
+    EXPECT_EQ(path->toRelativeString(), "clock/main_clock");
+
+    EXPECT_EQ(*PropertyPath::parse("clock/main_clock/"), *path);
+    EXPECT_EQ(*PropertyPath::parse("/clock/main_clock/"), *path);
+}
+
+TEST(PropertyPath, ParsesRoot)
+{
+    for (const auto& root : { "", "/" })
+    {
+        const auto path = PropertyPath::parse(root);
+        ASSERT_TRUE(path);
+        EXPECT_TRUE(path->isRoot());
+        EXPECT_EQ(path->name(), "");
+        EXPECT_EQ(path->toString(), "/");
+        EXPECT_EQ(path->toNodeString(), "/");
+        EXPECT_EQ(path->toRelativeString(), "");
+    }
+}
+
+TEST(PropertyPath, RejectsInvalidPaths)
+{
+    for (const auto& invalid : { "//", "a//b", "/a b", "a/b-c", "a.b", "//a", "a//" })
+    {
+        EXPECT_FALSE(PropertyPath::parse(invalid)) << invalid;
+        EXPECT_FALSE(PropertyPath::isValid(invalid)) << invalid;
+    }
+}
+
+TEST(PropertyPath, AcceptsDotSeparatorIfAllowed)
+{
+    const auto path = PropertyPath::parse("clock.main_clock", true);
+    ASSERT_TRUE(path);
+    EXPECT_EQ(path->toString(), "/clock/main_clock");
+    EXPECT_TRUE(PropertyPath::isValid("clock.main_clock", true));
+    EXPECT_FALSE(PropertyPath::isValid("clock..main_clock", true));
+}
+
+TEST(PropertyPath, ParentAndAppend)
+{
+    const auto node = *PropertyPath::parse("clock");
+    const auto name = *PropertyPath::parse("/main_clock/");
+    const auto path = node.append(name);
+    EXPECT_EQ(path.toString(), "/clock/main_clock");
+    EXPECT_EQ(path.parent(), node);
+    EXPECT_TRUE(node.parent().isRoot());
+    EXPECT_TRUE(PropertyPath().parent().isRoot());
+    EXPECT_NE(path, node);
+}
+
+TEST(PropertyPath, InternsOnlyOnRequest)
+{
+    const auto path = *PropertyPath::parse("never_interned_node/never_interned_property");
+    EXPECT_EQ(path.toString(), "/never_interned_node/never_interned_property");
+    EXPECT_EQ(PropertyPath::findSegment("never_interned_node"), nullptr);
+    EXPECT_EQ(path.parent().append(*PropertyPath::parse("never_interned_property")), path);
+
+    const auto interned_path = path.interned();
+    EXPECT_EQ(interned_path, path);
+    EXPECT_EQ(PropertyPath::findSegment("never_interned_node"), &interned_path.segment(0));
+    // parsing finds the interned segments
+    EXPECT_EQ(&PropertyPath::parse("never_interned_node")->segment(0), &interned_path.segment(0));
+}
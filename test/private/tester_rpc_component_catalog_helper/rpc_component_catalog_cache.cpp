@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "rpc_component_catalog_cache.h"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace
+{
+using Catalog = fep3::RPCComponentCatalogCache::Catalog;
+
+const Catalog complete_catalog{
+    { "participant_info.arya.fep3.iid", { "participant_info" } },
+    { "configuration.arya.fep3.iid", { "configuration" } } };
+} // namespace
+
+TEST(RPCComponentCatalogCache, fetchesTheCatalogOncePerGeneration)
+{
+    fep3::RPCComponentCatalogCache cache;
+    int fetches = 0;
+    const auto fetch = [&](Catalog& catalog)
+    {
+        ++fetches;
+        catalog = complete_catalog;
+        return true;
+    };
+
+    EXPECT_EQ(cache.getComponentsWhichSupports(fetch, "configuration.arya.fep3.iid"),
+        std::vector<std::string>{ "configuration" });
+    EXPECT_TRUE(cache.getComponentsWhichSupports(fetch, "unknown.iid").empty());
+    cache.refreshIfOutdated(fetch);
+    EXPECT_EQ(fetches, 1);
+
+    cache.getInvalidator()();
+    cache.getComponentsWhichSupports(fetch, "configuration.arya.fep3.iid");
+    EXPECT_EQ(fetches, 2);
+}
+
+TEST(RPCComponentCatalogCache, fetchesAnIncompleteCatalogAgain)
+{
+    fep3::RPCComponentCatalogCache cache;
+    int fetches = 0;
+    // the first fetch fails, e.g. the iids of the configuration could not be requested
+    const auto fetch = [&](Catalog& catalog)
+    {
+        ++fetches;
+        if (fetches == 1)
+        {
+            catalog = { { "participant_info.arya.fep3.iid", { "participant_info" } } };
+            return false;
+        }
+        catalog = complete_catalog;
+        return true;
+    };
+
+    // the incomplete catalog serves the running lookup
+    EXPECT_EQ(cache.getComponentsWhichSupports(fetch, "participant_info.arya.fep3.iid"),
+        std::vector<std::string>{ "participant_info" });
+    EXPECT_EQ(fetches, 1);
+    // but is not kept for the generation
+    EXPECT_EQ(cache.getComponentsWhichSupports(fetch, "configuration.arya.fep3.iid"),
+        std::vector<std::string>{ "configuration" });
+    EXPECT_EQ(fetches, 2);
+    cache.getComponentsWhichSupports(fetch, "configuration.arya.fep3.iid");
+    EXPECT_EQ(fetches, 2);
+}
+
+TEST(RPCComponentCatalogCache, keepsTheGenerationIfTheFetchThrows)
+{
+    fep3::RPCComponentCatalogCache cache;
+    bool reachable = false;
+    const auto fetch = [&](Catalog& catalog)
+    {
+        if (!reachable)
+        {
+            throw std::runtime_error("participant is unreachable");
+        }
+        catalog = complete_catalog;
+        return true;
+    };
+
+    EXPECT_THROW(cache.refreshIfOutdated(fetch), std::runtime_error);
+    reachable = true;
+    EXPECT_EQ(cache.getComponentsWhichSupports(fetch, "configuration.arya.fep3.iid"),
+        std::vector<std::string>{ "configuration" });
+}
+
+TEST(RPCComponentCatalogCache, generationSourceOutlivesTheCache)
+{
+    std::function<void()> invalidate;
+    std::function<uint64_t()> generation;
+    {
+        fep3::RPCComponentCatalogCache cache;
+        invalidate = cache.getInvalidator();
+        generation = cache.getGenerationSource();
+        const auto before = generation();
+        invalidate();
+        EXPECT_EQ(generation(), before + 1);
+    }
+    invalidate();
+    EXPECT_EQ(generation(), 0u);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "string_pool.h"
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(StringPool, internsEqualStringsOnce)
+{
+    fep3::StringPool pool;
+    const auto job_name = pool.intern("job");
+    EXPECT_EQ(*job_name, "job");
+    EXPECT_EQ(pool.intern(std::string("jo") + "b"), job_name);
+    EXPECT_EQ(pool.intern(std::string_view("job_name").substr(0, 3)), job_name);
+    EXPECT_NE(pool.intern("signal"), job_name);
+    EXPECT_EQ(*pool.intern({}), "");
+    EXPECT_EQ(pool.find("job"), job_name);
+    EXPECT_EQ(pool.find("unknown"), nullptr);
+}
+
+TEST(StringPool, keepsPoolsApart)
+{
+    fep3::StringPool first, second;
+    EXPECT_NE(first.intern("job"), second.intern("job"));
+}
+
+TEST(StringPool, internsConcurrently)
+{
+    constexpr int thread_count = 4, string_count = 500;
+    fep3::StringPool pool;
+    std::vector<std::vector<const std::string*>> interned(thread_count);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < thread_count; ++thread)
+    {
+        threads.emplace_back([&pool, &interned, thread]() {
+            for (int string = 0; string < string_count; ++string)
+            {
+                interned[thread].push_back(pool.intern("job_" + std::to_string(string)));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (int thread = 1; thread < thread_count; ++thread)
+    {
+        EXPECT_EQ(interned[thread], interned[0]);
+    }
+    EXPECT_EQ(*interned[0][42], "job_42");
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "bounded_mpsc_queue.h"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(BoundedMpscQueue, keepsTheOrderUpToItsCapacity)
+{
+    fep3::BoundedMpscQueue<std::string> queue(3);
+    ASSERT_EQ(queue.capacity(), 4u);
+
+    for (int value = 0; value < 4; ++value)
+    {
+        ASSERT_TRUE(queue.tryPush(std::to_string(value)));
+    }
+    std::string rejected = "4";
+    EXPECT_FALSE(queue.tryPush(std::move(rejected)));
+    EXPECT_EQ(rejected, "4");
+    EXPECT_EQ(queue.size(), 4u);
+
+    std::string value;
+    for (int expected = 0; expected < 4; ++expected)
+    {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, std::to_string(expected));
+        // wraps around
+        ASSERT_TRUE(queue.tryPush(std::to_string(expected + 4)));
+    }
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, "4");
+}
+
+TEST(BoundedMpscQueue, deliversAllValuesOfConcurrentProducers)
+{
+    constexpr int producer_count = 4;
+    constexpr int values_per_producer = 5000;
+    fep3::BoundedMpscQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producer_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (int value = 0; value < values_per_producer; ++value)
+            {
+                while (!queue.tryPush(producer * values_per_producer + value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // the values of each producer arrive in order
+    std::vector<int> next_values(producer_count, 0);
+    int received = 0;
+    while (received < producer_count * values_per_producer)
+    {
+        int value = 0;
+        if (queue.tryPop(value))
+        {
+            const auto producer = value / values_per_producer;
+            ASSERT_EQ(value % values_per_producer, next_values[producer]++);
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(queue.size(), 0u);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "event_monitor_list.h"
+#include "log_name_table.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+struct RecordingMonitor : public fep3::IEventMonitor
+{
+    void onLog(std::chrono::milliseconds,
+        fep3::LoggerSeverity,
+        const std::string& participant_name,
+        const std::string& logger_name,
+        const std::string& message) override
+    {
+        _records.push_back(participant_name + "/" + logger_name + "/" + message);
+    }
+    std::vector<std::string> _records;
+};
+
+void dispatch(const fep3::EventMonitorList& monitors,
+    fep3::LoggerSeverity severity,
+    const std::string& participant_name,
+    const std::string& logger_name,
+    std::string message)
+{
+    monitors.dispatch({ 0ms,
+        severity,
+        fep3::LogNameTable::intern(participant_name),
+        fep3::LogNameTable::intern(logger_name),
+        std::move(message) });
+}
+} // namespace
+
+TEST(EventMonitorList, dispatchesToTheMatchingMonitorsOnly)
+{
+    fep3::EventMonitorList monitors;
+    RecordingMonitor all, warnings, participant_1, elements;
+    monitors.add(all);
+    monitors.add(warnings, { fep3::LoggerSeverity::warning, {}, {} });
+    monitors.add(participant_1, { fep3::LoggerSeverity::debug, { "participant_1" }, {} });
+    monitors.add(elements, { fep3::LoggerSeverity::info, {}, "element" });
+    ASSERT_EQ(monitors.size(), 4u);
+
+    dispatch(monitors, fep3::LoggerSeverity::error, "participant_1", "element.a", "1");
+    dispatch(monitors, fep3::LoggerSeverity::debug, "participant_1", "element.a", "2");
+    dispatch(monitors, fep3::LoggerSeverity::info, "participant_2", "component", "3");
+    dispatch(monitors, fep3::LoggerSeverity::warning, "", "system", "4");
+
+    EXPECT_EQ(all._records.size(), 4u);
+    EXPECT_EQ(warnings._records, (std::vector<std::string>{ "participant_1/element.a/1", "/system/4" }));
+    EXPECT_EQ(participant_1._records, (std::vector<std::string>{ "participant_1/element.a/1", "participant_1/element.a/2" }));
+    EXPECT_EQ(elements._records, (std::vector<std::string>{ "participant_1/element.a/1" }));
+
+    // registering again replaces the filter
+    monitors.add(warnings, { fep3::LoggerSeverity::off, {}, {} });
+    EXPECT_EQ(monitors.size(), 4u);
+    EXPECT_TRUE(monitors.remove(all));
+    EXPECT_FALSE(monitors.remove(all));
+    dispatch(monitors, fep3::LoggerSeverity::fatal, "participant_1", "element.a", "5");
+    EXPECT_EQ(all._records.size(), 4u);
+    EXPECT_EQ(warnings._records.size(), 2u);
+    EXPECT_EQ(participant_1._records.size(), 3u);
+
+    monitors.clear();
+    EXPECT_EQ(monitors.size(), 0u);
+}
+
+TEST(EventMonitorList, passesTheRecordWithoutCopying)
+{
+    struct RecordMonitor : public fep3::IEventMonitor
+    {
+        void onLogRecord(const fep3::LogRecord& record) override
+        {
+            _record = &record;
+        }
+        const fep3::LogRecord* _record = nullptr;
+    } record_monitor;
+    RecordingMonitor adapted_monitor;
+
+    fep3::EventMonitorList monitors;
+    monitors.add(record_monitor);
+    monitors.add(adapted_monitor);
+    const fep3::LogRecord record(1500us,
+        fep3::LoggerSeverity::info,
+        fep3::LogNameTable::intern("participant_1"),
+        fep3::LogNameTable::intern("element.a"),
+        "message");
+    monitors.dispatch(record);
+
+    EXPECT_EQ(record_monitor._record, &record);
+    // the former callback is called by the default implementation of onLogRecord
+    EXPECT_EQ(adapted_monitor._records, (std::vector<std::string>{ "participant_1/element.a/message" }));
+    EXPECT_EQ(record.getTimeAsMilliseconds(), 1ms);
+}
+
+TEST(EventMonitorList, removeWaitsForARunningCall)
+{
+    struct BlockingMonitor : public fep3::IEventMonitor
+    {
+        void onLog(std::chrono::milliseconds, fep3::LoggerSeverity, const std::string&, const std::string&, const std::string&) override
+        {
+            _entered.set_value();
+            std::this_thread::sleep_for(100ms);
+            _left = true;
+        }
+        std::promise<void> _entered;
+        std::atomic<bool> _left{ false };
+    } monitor;
+
+    fep3::EventMonitorList monitors;
+    monitors.add(monitor);
+    std::thread dispatching([&]() { dispatch(monitors, fep3::LoggerSeverity::info, "", "system", "message"); });
+    monitor._entered.get_future().wait();
+    monitors.remove(monitor);
+    EXPECT_TRUE(monitor._left);
+    dispatching.join();
+}
+
+TEST(EventMonitorList, replacingTheFilterKeepsTheCallsSerialized)
+{
+    struct BlockingMonitor : public fep3::IEventMonitor
+    {
+        void onLog(std::chrono::milliseconds, fep3::LoggerSeverity, const std::string&, const std::string&, const std::string&) override
+        {
+            if (++_running > 1)
+            {
+                _concurrent = true;
+            }
+            if (!_blocked.exchange(true))
+            {
+                _entered.set_value();
+                std::this_thread::sleep_for(100ms);
+            }
+            --_running;
+        }
+        std::promise<void> _entered;
+        std::atomic<bool> _blocked{ false };
+        std::atomic<int> _running{ 0 };
+        std::atomic<bool> _concurrent{ false };
+    } monitor;
+
+    fep3::EventMonitorList monitors;
+    monitors.add(monitor);
+    std::thread dispatching([&]() { dispatch(monitors, fep3::LoggerSeverity::info, "", "system", "first"); });
+    monitor._entered.get_future().wait();
+    monitors.add(monitor, { fep3::LoggerSeverity::debug, {}, "sys" });
+    // waits for the running call of the monitor instead of overlapping it
+    dispatch(monitors, fep3::LoggerSeverity::debug, "", "system", "second");
+    dispatching.join();
+
+    EXPECT_FALSE(monitor._concurrent);
+    EXPECT_EQ(monitors.size(), 1u);
+}
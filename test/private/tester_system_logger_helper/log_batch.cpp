@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_batch.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+class RecordingLogger : public fep3::ISystemLogger
+{
+public:
+    void log(const std::chrono::milliseconds&, fep3::LoggerSeverity, const std::string&, const std::string&, const std::string&) const override
+    {
+    }
+    void log(fep3::LoggerSeverity, const std::string&, const std::string&, const std::string&) const override
+    {
+    }
+    void log(fep3::LogRecord&& record) const override
+    {
+        _records.push_back(std::move(record));
+    }
+    bool isSeverityEnabled(fep3::LoggerSeverity level) const override
+    {
+        return level != fep3::LoggerSeverity::off && static_cast<int>(level) <= static_cast<int>(fep3::LoggerSeverity::warning);
+    }
+    std::string getUrl() const override
+    {
+        return {};
+    }
+
+    mutable std::vector<fep3::LogRecord> _records;
+};
+
+Json::Value record(Json::Value timestamp, Json::Value severity, Json::Value logger_name, Json::Value message)
+{
+    Json::Value value(Json::arrayValue);
+    value.append(timestamp);
+    value.append(severity);
+    value.append(logger_name);
+    value.append(message);
+    return value;
+}
+} // namespace
+
+TEST(LogRecordBatch, passesWellFormedRecords)
+{
+    RecordingLogger logger;
+    Json::Value records(Json::arrayValue);
+    records.append(record(Json::Int64(1500000), static_cast<int>(fep3::LoggerSeverity::error), "element", "first"));
+    records.append(record(Json::Int64(2500000), static_cast<int>(fep3::LoggerSeverity::warning), "element", "second"));
+
+    EXPECT_EQ(fep3::logRecordBatch(logger, "participant", records), 2);
+    ASSERT_EQ(logger._records.size(), 2u);
+    EXPECT_EQ(logger._records[0]._timestamp, 1500000ns);
+    EXPECT_EQ(logger._records[0]._severity, fep3::LoggerSeverity::error);
+    EXPECT_EQ(logger._records[0].getParticipantName(), "participant");
+    EXPECT_EQ(logger._records[0].getLoggerName(), "element");
+    EXPECT_EQ(logger._records[0]._message, "first");
+    EXPECT_EQ(logger._records[1]._message, "second");
+    // the names are interned
+    EXPECT_EQ(logger._records[0]._logger_name, logger._records[1]._logger_name);
+}
+
+TEST(LogRecordBatch, skipsMalformedRecords)
+{
+    RecordingLogger logger;
+    const auto error = static_cast<int>(fep3::LoggerSeverity::error);
+    Json::Value records(Json::arrayValue);
+    records.append("not a record");
+    records.append(record(0, error, "element", "valid"));
+    records.append(record("0", error, "element", "timestamp is a string"));
+    records.append(record(0, "error", "element", "severity is a string"));
+    records.append(record(0, error, Json::Value(Json::arrayValue), "logger name is an array"));
+    records.append(record(0, error, "element", Json::Value(Json::objectValue)));
+    records.append(record(Json::UInt64(9223372036854775808ull), error, "element", "timestamp out of int64 range"));
+    records.append(record(0, Json::Int64(4294967296), "element", "severity out of int range"));
+    records.append(record(0, -1, "element", "severity below fatal"));
+    records.append(record(0, static_cast<int>(fep3::LoggerSeverity::off), "element", "severity off"));
+    records.append(record(0, static_cast<int>(fep3::LoggerSeverity::debug) + 1, "element", "severity above debug"));
+    auto too_long = record(0, error, "element", "too long");
+    too_long.append(0);
+    records.append(too_long);
+
+    EXPECT_EQ(fep3::logRecordBatch(logger, "participant", records), 1);
+    ASSERT_EQ(logger._records.size(), 1u);
+    EXPECT_EQ(logger._records[0]._message, "valid");
+
+    EXPECT_EQ(fep3::logRecordBatch(logger, "participant", Json::Value(Json::objectValue)), 0);
+    EXPECT_EQ(logger._records.size(), 1u);
+}
+
+TEST(LogRecordBatch, filtersBySeverity)
+{
+    RecordingLogger logger;
+    Json::Value records(Json::arrayValue);
+    records.append(record(0, static_cast<int>(fep3::LoggerSeverity::info), "element", "filtered"));
+    records.append(record(0, static_cast<int>(fep3::LoggerSeverity::debug), "element", "filtered"));
+    records.append(record(0, static_cast<int>(fep3::LoggerSeverity::fatal), "element", "passed"));
+
+    // filtered records are well formed and count as accepted
+    EXPECT_EQ(fep3::logRecordBatch(logger, "participant", records), 3);
+    ASSERT_EQ(logger._records.size(), 1u);
+    EXPECT_EQ(logger._records[0]._message, "passed");
+}
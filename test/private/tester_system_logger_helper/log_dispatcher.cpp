@@ -0,0 +1,130 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_dispatcher.h"
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+fep3::LogRecord makeRecord(const std::string& message)
+{
+    static const std::string participant_name = "participant", logger_name = "logger";
+    return { 0ms, fep3::LoggerSeverity::info, &participant_name, &logger_name, message };
+}
+} // namespace
+
+TEST(LogDispatcher, deliversOnItsOwnThreadAndDrainsOnDestruction)
+{
+    fep3::LogDispatchCounters counters;
+    std::vector<std::string> messages;
+    std::thread::id delivery_thread;
+    {
+        fep3::LogDispatcher dispatcher(16, fep3::LogOverflowPolicy::block, counters,
+            [&](const fep3::LogRecord& record) {
+                delivery_thread = std::this_thread::get_id();
+                messages.push_back(record._message);
+                if (record._message == "1")
+                {
+                    throw std::runtime_error("failing receiver");
+                }
+            });
+        for (int message = 0; message < 100; ++message)
+        {
+            dispatcher.push(makeRecord(std::to_string(message)));
+        }
+    }
+    ASSERT_EQ(messages.size(), 100u);
+    EXPECT_EQ(messages.back(), "99");
+    EXPECT_NE(delivery_thread, std::this_thread::get_id());
+    EXPECT_EQ(counters._delivered, 100u);
+    EXPECT_EQ(counters._dropped, 0u);
+    // the queue is smaller than the number of records
+    EXPECT_GT(counters._blocked, 0u);
+}
+
+TEST(LogDispatcher, dropsTheOldestRecordsIfFull)
+{
+    fep3::LogDispatchCounters counters;
+    std::promise<void> release_delivery;
+    auto delivery_released = release_delivery.get_future().share();
+    std::vector<std::string> messages;
+    {
+        fep3::LogDispatcher dispatcher(4, fep3::LogOverflowPolicy::drop_oldest, counters,
+            [&](const fep3::LogRecord& record) {
+                delivery_released.wait();
+                messages.push_back(record._message);
+            });
+        dispatcher.push(makeRecord("first"));
+        // the first record is taken by the blocked delivery, the others fill the queue
+        while (dispatcher.getQueuedCount() != 0)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        for (int message = 0; message < 10; ++message)
+        {
+            dispatcher.push(makeRecord(std::to_string(message)));
+        }
+        EXPECT_EQ(dispatcher.getQueuedCount(), 4u);
+        EXPECT_EQ(counters._dropped, 6u);
+        release_delivery.set_value();
+    }
+    EXPECT_EQ(messages, (std::vector<std::string>{ "first", "6", "7", "8", "9" }));
+    EXPECT_EQ(counters._delivered, 5u);
+    EXPECT_EQ(counters._blocked, 0u);
+}
+
+TEST(LogDispatcher, mayBeDroppedFromWithinTheDelivery)
+{
+    fep3::LogDispatchCounters counters;
+    std::promise<void> release_delivery, dropped_within_delivery;
+    auto delivery_released = release_delivery.get_future().share();
+    std::shared_ptr<fep3::LogDispatcher> dispatcher;
+    auto holder = std::make_shared<fep3::LogDispatcher>(4, fep3::LogOverflowPolicy::block, counters,
+        [&](const fep3::LogRecord&) {
+            delivery_released.wait();
+            // e.g. a monitor replacing the asynchronous logging while holding the last reference
+            std::atomic_store(&dispatcher, std::shared_ptr<fep3::LogDispatcher>());
+            dropped_within_delivery.set_value();
+        });
+    std::atomic_store(&dispatcher, holder);
+    holder->push(makeRecord("first"));
+    while (holder->getQueuedCount() != 0)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    holder->push(makeRecord("second"));
+    holder->push(makeRecord("third"));
+    holder.reset();
+    release_delivery.set_value();
+
+    // does not join its own thread
+    dropped_within_delivery.get_future().wait();
+    EXPECT_FALSE(std::atomic_load(&dispatcher));
+    for (int retry = 0; retry < 1000 && counters._dropped != 2; ++retry)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(counters._delivered, 1u);
+    EXPECT_EQ(counters._dropped, 2u);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+    This Source Code Form is subject to the terms of the Mozilla
+    Public License, v. 2.0. If a copy of the MPL was not distributed
+    with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular file, then
+You may include the notice in a location (such as a LICENSE file in a
+relevant directory) where a recipient would be likely to look for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+@endverbatim
+ */
+
+#include "log_name_table.h"
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(LogNameTable, internsEqualNamesOnce)
+{
+    const auto participant_name = fep3::LogNameTable::intern("participant");
+    EXPECT_EQ(*participant_name, "participant");
+    EXPECT_EQ(fep3::LogNameTable::intern(std::string("partici") + "pant"), participant_name);
+    EXPECT_NE(fep3::LogNameTable::intern("logger"), participant_name);
+    EXPECT_EQ(*fep3::LogNameTable::intern(""), "");
+}
+
+TEST(LogNameTable, internsConcurrently)
+{
+    constexpr int thread_count = 4, name_count = 200;
+    std::vector<std::vector<const std::string*>> interned(thread_count);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < thread_count; ++thread)
+    {
+        threads.emplace_back([&interned, thread]() {
+            for (int name = 0; name < name_count; ++name)
+            {
+                interned[thread].push_back(fep3::LogNameTable::intern("logger_" + std::to_string(name)));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (int thread = 1; thread < thread_count; ++thread)
+    {
+        EXPECT_EQ(interned[thread], interned[0]);
+    }
+    EXPECT_EQ(*interned[0][42], "logger_42");
+}